@@ -0,0 +1,144 @@
+/**
+ * Copyright ©2021-2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+
+/**
+ * Allocator returning memory aligned to a fixed boundary, for buffers
+ * that are read with aligned SIMD loads and gathers, such as the column
+ * buffers filled by Combination::const_iterator::nextBatchColumns.
+ *
+ * As an example of use:
+ *     using Allocator = AlignedAllocator< uint32_t, 64 >;
+ *     size_t stride = Allocator::paddedSize( 1024 );
+ *     std::vector< uint32_t, Allocator > columns( stride * subsetSize );
+ *     iterator.nextBatchColumns( columns.data(), 1024, stride );
+ *
+ * Note:
+ *   - Requires C++14 and above.
+ */
+template < typename T, size_t Alignment = 64 >
+class AlignedAllocator
+{
+	static_assert( ( 0 != Alignment ) and ( 0 == ( Alignment & ( Alignment - 1 ) ) ),
+		"Alignment must be a power of two" );
+	static_assert( alignof( T ) <= Alignment, "Alignment must be at least the alignment of T" );
+
+	// The fewest elements spanning a whole number of Alignment bytes,
+	// Alignment / gcd( Alignment, sizeof( T ) ), where the gcd with a power
+	// of two is the lowest set bit of sizeof( T ), capped at Alignment.
+	static constexpr size_t _blockElements()
+	{
+		return Alignment / std::min( Alignment, sizeof( T ) & ( ~sizeof( T ) + 1 ) );
+	}
+
+public:
+	using value_type = T;
+
+	template < typename U >
+	struct rebind
+	{
+		using other = AlignedAllocator< U, Alignment >;
+	};
+
+	/**
+	 * Default constructor.
+	 */
+	AlignedAllocator() = default;
+
+	/**
+	 * Converting copy constructor.
+	 * @param other Const reference to the allocator of another type to copy.
+	 */
+	template < typename U >
+	AlignedAllocator(
+		const AlignedAllocator< U, Alignment >& )
+	{
+	}
+
+	/**
+	 * The number of elements, rounded up such that consecutive
+	 * blocks of that many elements each start on the alignment.
+	 * @param count The number of elements.
+	 * @return {@param count} rounded up to the fewest elements spanning a multiple of Alignment bytes.
+	 */
+	static size_t paddedSize(
+		size_t count )
+	{
+		return ( count + _blockElements() - 1 ) / _blockElements() * _blockElements();
+	}
+
+	/**
+	 * Allocate aligned storage.
+	 * @param count The number of elements to allocate storage for.
+	 * @return Pointer to the storage, aligned to Alignment bytes.
+	 * @throw std::bad_alloc if the storage couldn't be allocated.
+	 */
+	T* allocate(
+		size_t count )
+	{
+		if ( ( std::numeric_limits< size_t >::max() - Alignment - sizeof( void* ) ) / sizeof( T ) < count )
+		{
+			throw std::bad_alloc();
+		}
+
+#if defined( __cpp_aligned_new )
+		return static_cast< T* >( ::operator new( count * sizeof( T ), std::align_val_t( Alignment ) ) );
+#else
+		// Over-allocate and keep the original pointer just before the aligned storage.
+		void* storage = ::operator new( count * sizeof( T ) + Alignment + sizeof( void* ) );
+		uintptr_t aligned = ( reinterpret_cast< uintptr_t >( storage ) + sizeof( void* ) + Alignment - 1 ) & ~uintptr_t( Alignment - 1 );
+		reinterpret_cast< void** >( aligned )[ -1 ] = storage;
+		return reinterpret_cast< T* >( aligned );
+#endif
+	}
+
+	/**
+	 * Release storage returned by allocate.
+	 * @param pointer Pointer to the storage to release.
+	 * @param count The number of elements the storage was allocated for.
+	 */
+	void deallocate(
+		T* pointer,
+		size_t count )
+	{
+#if defined( __cpp_aligned_new )
+		::operator delete( pointer, count * sizeof( T ), std::align_val_t( Alignment ) );
+#else
+		( void ) count;
+		::operator delete( reinterpret_cast< void** >( pointer )[ -1 ] );
+#endif
+	}
+};
+
+/**
+ * Equality operator, all aligned allocators of the same alignment are interchangeable.
+ * @return Return true.
+ */
+template < typename T, typename U, size_t Alignment >
+bool operator==(
+	const AlignedAllocator< T, Alignment >&,
+	const AlignedAllocator< U, Alignment >& )
+{
+	return true;
+}
+
+/**
+ * Inequality operator, all aligned allocators of the same alignment are interchangeable.
+ * @return Return false.
+ */
+template < typename T, typename U, size_t Alignment >
+bool operator!=(
+	const AlignedAllocator< T, Alignment >&,
+	const AlignedAllocator< U, Alignment >& )
+{
+	return false;
+}
@@ -0,0 +1,259 @@
+/**
+ * Copyright ©2021-2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// The number of rows, n = 0 .. COMBINATION_PASCAL_ROWS - 1, held by PascalTriangle.
+#if !defined( COMBINATION_PASCAL_ROWS )
+#define COMBINATION_PASCAL_ROWS 128
+#endif
+
+/**
+ * Compute the binomial coefficient, n choose k, with overflow detection.
+ * The coefficient is built up as C(n - k + i, i) for i = 1 .. k, with the
+ * common factor removed before each multiplication so that an overflow is
+ * only reported when the result itself can't be represented. This is the
+ * fallback of binomialCoefficient for rows beyond PascalTriangle.
+ * @param n Number of elements to choose from.
+ * @param k Number of elements to choose.
+ * @param coefficient Reference to write the coefficient to. For k > n this is 0.
+ * @return True if the coefficient fits in a size_t, false if it overflowed.
+ */
+inline bool computeBinomialCoefficient(
+	size_t n,
+	size_t k,
+	size_t& coefficient )
+{
+	if ( n < k )
+	{
+		coefficient = 0;
+		return true;
+	}
+
+	if ( n - k < k )
+	{
+		k = n - k;
+	}
+
+	coefficient = 1;
+	for ( size_t index = 1; index <= k; ++index )
+	{
+		size_t factor = n - k + index;
+		size_t divisor = index;
+
+		size_t a = coefficient;
+		size_t b = divisor;
+		for ( ; b; a %= b, std::swap( a, b ) );
+
+		coefficient /= a;
+		factor /= ( divisor / a );
+
+		if ( ( std::numeric_limits< size_t >::max() / factor ) < coefficient )
+		{
+			return false;
+		}
+
+		coefficient *= factor;
+	}
+
+	return true;
+}
+
+/**
+ * Class holding rows 0 .. COMBINATION_PASCAL_ROWS - 1 of Pascal's triangle
+ * as CountT. The size_t triangle backs binomialCoefficient, and so the
+ * ranking, unranking, slicing and size() of the enumerations. The triangle
+ * is built once, on the first call to instance(), and only the left half of
+ * each row is kept, k <= n / 2, with the rows flattened end to end so that
+ * neighbouring rows share cache lines.
+ * Coefficients too large for CountT are stored saturated at its maximum.
+ *
+ * As an example of use:
+ *     size_t count;
+ *     if ( PascalTriangle64::instance().lookup( 60, 30, count ) ) {
+ *         use( count ); }
+ *
+ * The 64-bit triangle of the default 128 rows takes 33KB, and the 128-bit
+ * triangle, which holds every coefficient of those rows exactly, 66KB.
+ *
+ * Note:
+ *   - Requires C++14 and above.
+ */
+template < typename CountT >
+class PascalTriangle
+{
+	// std::numeric_limits doesn't know of unsigned __int128 in strict ISO modes.
+	static_assert( ( CountT( 0 ) < CountT( ~CountT( 0 ) ) ) and ( CountT( 1 ) / CountT( 2 ) == CountT( 0 ) ),
+		"CountT must be an unsigned integral type" );
+
+private:
+	std::vector< CountT > mCoefficients;
+
+	static size_t _rowOffset(
+		size_t n )
+	{
+		// Rows before n hold ( m / 2 + 1 ) coefficients each, for m = 0 .. n - 1.
+		return n + ( n / 2 ) * ( ( n - 1 ) / 2 );
+	}
+
+	PascalTriangle()
+	{
+		mCoefficients.resize( _rowOffset( Rows ) );
+
+		for ( size_t n = 0; n < Rows; ++n )
+		{
+			CountT* row = mCoefficients.data() + _rowOffset( n );
+			row[ 0 ] = 1;
+
+			for ( size_t k = 1; k <= n / 2; ++k )
+			{
+				CountT left = saturated( n - 1, k - 1 );
+				CountT right = saturated( n - 1, k );
+				row[ k ] = ( Saturated - left < right ) ? Saturated : CountT( left + right );
+			}
+		}
+	}
+
+public:
+	static constexpr size_t Rows = COMBINATION_PASCAL_ROWS;
+	static constexpr CountT Saturated = CountT( ~CountT( 0 ) );
+
+	PascalTriangle( const PascalTriangle& ) = delete;
+	PascalTriangle& operator=( const PascalTriangle& ) = delete;
+
+	/**
+	 * The shared triangle, built on first use.
+	 * @return Const reference to the triangle.
+	 */
+	static const PascalTriangle& instance()
+	{
+		static const PascalTriangle triangle;
+		return triangle;
+	}
+
+	/**
+	 * Look up n choose k, reporting whether it can be represented.
+	 * @param n Number of elements to choose from, less than Rows.
+	 * @param k Number of elements to choose.
+	 * @param coefficient Reference to write the coefficient to, Saturated if it overflowed. For k > n this is 0.
+	 * @return True if the coefficient fits in a CountT, false if it overflowed.
+	 * @throw std::out_of_range if {@param n} isn't less than Rows.
+	 */
+	bool lookup(
+		size_t n,
+		size_t k,
+		CountT& coefficient ) const
+	{
+		if ( Rows <= n )
+		{
+			throw std::out_of_range( "n is outside of the triangle" );
+		}
+
+		coefficient = saturated( n, k );
+		return Saturated != coefficient;
+	}
+
+	/**
+	 * Look up n choose k without bounds checking.
+	 * @param n Number of elements to choose from, less than Rows.
+	 * @param k Number of elements to choose.
+	 * @return The coefficient, or Saturated if it doesn't fit in a CountT. For k > n this is 0.
+	 */
+	CountT saturated(
+		size_t n,
+		size_t k ) const
+	{
+		if ( n < k )
+		{
+			return 0;
+		}
+
+		return mCoefficients[ _rowOffset( n ) + std::min( k, n - k ) ];
+	}
+};
+
+template < typename CountT >
+constexpr size_t PascalTriangle< CountT >::Rows;
+
+template < typename CountT >
+constexpr CountT PascalTriangle< CountT >::Saturated;
+
+/**
+ * Pascal's triangle of 64-bit coefficients.
+ */
+using PascalTriangle64 = PascalTriangle< uint64_t >;
+
+#if defined( __SIZEOF_INT128__ ) && !defined( COMBINATION_DISABLE_INT128 )
+/**
+ * Pascal's triangle of 128-bit coefficients, holding every coefficient of
+ * the default 128 rows exactly. This is a standalone utility for counts
+ * beyond a size_t; the enumerations themselves rank with size_t counts.
+ * Define COMBINATION_DISABLE_INT128 to leave out the 128-bit types.
+ */
+using PascalTriangle128 = PascalTriangle< unsigned __int128 >;
+#endif
+
+/**
+ * Compute the binomial coefficient, n choose k, with overflow detection.
+ * Rows within PascalTriangle are looked up, and only larger n are computed.
+ * @param n Number of elements to choose from.
+ * @param k Number of elements to choose.
+ * @param coefficient Reference to write the coefficient to. For k > n this is 0.
+ * @return True if the coefficient fits in a size_t, false if it overflowed.
+ */
+inline bool binomialCoefficient(
+	size_t n,
+	size_t k,
+	size_t& coefficient )
+{
+	if ( n < PascalTriangle< size_t >::Rows )
+	{
+		return PascalTriangle< size_t >::instance().lookup( n, k, coefficient );
+	}
+
+	return computeBinomialCoefficient( n, k, coefficient );
+}
+
+/**
+ * Compute the falling factorial, n! / ( n - k )!, the number of ordered
+ * selections of k of n elements, with overflow detection.
+ * @param n Number of elements to choose from.
+ * @param k Number of elements to choose.
+ * @param product Reference to write the falling factorial to. For k > n this is 0.
+ * @return True if the falling factorial fits in a size_t, false if it overflowed.
+ */
+inline bool fallingFactorial(
+	size_t n,
+	size_t k,
+	size_t& product )
+{
+	if ( n < k )
+	{
+		product = 0;
+		return true;
+	}
+
+	product = 1;
+	for ( size_t factor = n - k + 1; factor <= n; ++factor )
+	{
+		if ( ( std::numeric_limits< size_t >::max() / factor ) < product )
+		{
+			return false;
+		}
+
+		product *= factor;
+	}
+
+	return true;
+}
@@ -0,0 +1,406 @@
+/**
+ * Copyright ©2021-2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#pragma once
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/**
+ * Class for enumerating over the subset combinations of a collection
+ * of at most 64 (or 128 with unsigned __int128) elements, where each
+ * subset is returned as a bitmask. Bit i of the mask is set if the
+ * element at offset i is in the subset.
+ *
+ * The subsets are enumerated in the same lexicographic order as
+ * Combination, and the same rules for an empty enumeration apply.
+ * Stepping to the next subset is a handful of bit operations rather
+ * than a scan over the offsets.
+ *
+ * As an example of use:
+ *     std::vector< char > characters { 'a', 'b', 'c', 'd', 'e', 'f', 'g' };
+ *     for ( uint64_t mask : BitmaskCombination<>( characters.size(), 4 ) ) {
+ *         for ( size_t offset = 0; offset < characters.size(); ++offset ) {
+ *             if ( mask & ( uint64_t( 1 ) << offset ) ) {
+ *                 std::cout << " " << characters[ offset ]; } }
+ *         std::cout << std::endl; }
+ *
+ * Note:
+ *   - Requires C++14 and above.
+ */
+template < typename MaskT = uint64_t >
+class BitmaskCombination
+{
+	static_assert( ( std::is_integral< MaskT >::value and std::is_unsigned< MaskT >::value )
+#if defined( __SIZEOF_INT128__ ) && !defined( COMBINATION_DISABLE_INT128 )
+		or std::is_same< MaskT, unsigned __int128 >::value
+#endif
+		, "MaskT must be an unsigned integral type" );
+
+public:
+	/**
+	 * The largest number of elements that a MaskT can hold.
+	 */
+	static constexpr size_t MaximumNumberElements = sizeof( MaskT ) * CHAR_BIT;
+
+private:
+	size_t mNumberElements;
+	size_t mSubsetSize;
+
+	void _copyAssign(
+		const BitmaskCombination& other )
+	{
+		mNumberElements = other.mNumberElements;
+		mSubsetSize = other.mSubsetSize;
+	}
+
+	void _moveAssign(
+		BitmaskCombination&& other )
+	{
+		mNumberElements = std::exchange( other.mNumberElements, 0 );
+		mSubsetSize = std::exchange( other.mSubsetSize, 0 );
+	}
+
+	static size_t _highestBit(
+		uint64_t mask )
+	{
+#if defined( __GNUC__ )
+		return 63 - __builtin_clzll( mask );
+#else
+		size_t bit = 0;
+		for ( ; mask >>= 1; ++bit );
+		return bit;
+#endif
+	}
+
+#if defined( __SIZEOF_INT128__ ) && !defined( COMBINATION_DISABLE_INT128 )
+	static size_t _highestBit(
+		unsigned __int128 mask )
+	{
+		uint64_t high = uint64_t( mask >> 64 );
+		return ( 0 != high ) ? 64 + _highestBit( high ) : _highestBit( uint64_t( mask ) );
+	}
+#endif
+
+	// Masks no wider than 64 bits go through the same overload.
+	using WideMaskT = typename std::conditional< sizeof( MaskT ) <= sizeof( uint64_t ), uint64_t, MaskT >::type;
+
+	static MaskT _lowBits(
+		size_t count )
+	{
+		return ( MaximumNumberElements <= count ) ? MaskT( ~MaskT( 0 ) ) : MaskT( ( MaskT( 1 ) << count ) - 1 );
+	}
+
+public:
+	/**
+	 * Iterator class for enumerating over the subset masks
+	 * of a collection.
+	 */
+	class const_iterator
+	{
+	private:
+		friend class BitmaskCombination;
+
+		bool mIsEnd;
+		size_t mNumberElements;
+		size_t mSubsetSize;
+		MaskT mMask;
+
+		const_iterator(
+			bool end,
+			size_t numberElements,
+			size_t subsetSize )
+		{
+			mIsEnd = end;
+			mNumberElements = numberElements;
+			mSubsetSize = subsetSize;
+			mMask = 0;
+
+			if ( not mIsEnd and ( 0 < mSubsetSize ) and ( mSubsetSize <= mNumberElements ) )
+			{
+				mMask = _lowBits( mSubsetSize );
+			}
+			else
+			{
+				mIsEnd = true;
+			}
+		}
+
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using difference_type   = std::ptrdiff_t;
+		using value_type        = const MaskT;
+		using pointer           = const MaskT*;
+		using reference         = const MaskT&;
+
+		/**
+		 * Default constructor.
+		 */
+		const_iterator()
+		{
+			mNumberElements = 0;
+			mSubsetSize = 0;
+			mMask = 0;
+			mIsEnd = true;
+		}
+
+		/**
+		 * Move constructor.
+		 * @param other R-Value to the iterator to move.
+		 */
+		const_iterator(
+			const_iterator&& other ) = default;
+
+		/**
+		 * Copy constructor.
+		 * @param other Const reference to the iterator to copy.
+		 */
+		const_iterator(
+			const const_iterator& other ) = default;
+
+		/**
+		 * Move assignment.
+		 * @param other R-Value to the iterator to move.
+		 * @return Reference to this iterator instance.
+		 */
+		const_iterator& operator=(
+			const_iterator&& other ) = default;
+
+		/**
+		 * Copy assignment.
+		 * @param other Const reference to the iterator to copy.
+		 * @return Reference to this iterator instance.
+		 */
+		const_iterator& operator=(
+			const const_iterator& other ) = default;
+
+		/**
+		 * Equality operator.
+		 * Comparing against an end iterator only tests the end flags.
+		 * @param other Const reference to the iterator to compare against.
+		 * @return Return true if {@param other} compares equal to this iterator instance.
+		 */
+		bool operator==(
+			const const_iterator& other ) const
+		{
+			if ( mIsEnd or other.mIsEnd )
+			{
+				return ( mIsEnd == other.mIsEnd )
+					and ( mNumberElements == other.mNumberElements )
+					and ( mSubsetSize == other.mSubsetSize );
+			}
+
+			return ( mNumberElements == other.mNumberElements )
+				and ( mSubsetSize == other.mSubsetSize )
+				and ( mMask == other.mMask );
+		}
+
+		/**
+		 * Inequality operator.
+		 * @param other Const reference to the iterator to compare against.
+		 * @return Return true if {@param other} compares not equal to this iterator instance.
+		 */
+		bool operator!=(
+			const const_iterator& other ) const
+		{
+			return not this->operator==( other );
+		}
+
+		/**
+		 * Member redirect.
+		 * @return Const pointer to the mask.
+		 */
+		pointer operator->() const
+		{
+			return &mMask;
+		}
+
+		/**
+		 * Dereference operator.
+		 * @return Const reference to the mask.
+		 */
+		reference operator*() const
+		{
+			return mMask;
+		}
+
+		/**
+		 * Post-increment operator.
+		 * @return iterator to the prior mask.
+		 */
+		const_iterator operator++( int )
+		{
+			const_iterator previous( *this );
+			this->operator++();
+			return previous;
+		}
+
+		/**
+		 * Pre-increment operator.
+		 * The run of set bits at the top of the N-bit window are the
+		 * offsets already at their maximum. The highest set bit below
+		 * that run is moved up by one, and the run is packed directly
+		 * above it.
+		 * @return Reference to this iterator instance.
+		 */
+		const_iterator& operator++()
+		{
+			MaskT unselected = MaskT( ~mMask & _lowBits( mNumberElements ) );
+
+			if ( 0 != unselected )
+			{
+				size_t highestUnselected = _highestBit( WideMaskT( unselected ) );
+				size_t topRun = mNumberElements - 1 - highestUnselected;
+				MaskT lower = MaskT( mMask & _lowBits( highestUnselected ) );
+
+				if ( 0 != lower )
+				{
+					size_t bump = _highestBit( WideMaskT( lower ) );
+					mMask = MaskT( ( lower ^ ( MaskT( 1 ) << bump ) )
+						| MaskT( _lowBits( topRun + 1 ) << ( bump + 1 ) ) );
+					return *this;
+				}
+			}
+
+			mIsEnd = true;
+			return *this;
+		}
+
+		/**
+		 * Swap this iterator with another.
+		 * @param other Reference to the iterator to swap with.
+		 */
+		void swap(
+			const_iterator& other )
+		{
+			std::swap( mIsEnd, other.mIsEnd );
+			std::swap( mNumberElements, other.mNumberElements );
+			std::swap( mSubsetSize, other.mSubsetSize );
+			std::swap( mMask, other.mMask );
+		}
+	};
+
+	/**
+	 * Default constructor.
+	 * @param numberElements Number of elements to choose from. [default: 0]
+	 * @param subsetSize Numer of element to choose. [default: 0]
+	 * @throw std::invalid_argument if {@param numberElements} exceeds the width of MaskT.
+	 */
+	BitmaskCombination(
+		size_t numberElements = 0,
+		size_t subsetSize = 0 )
+	{
+		if ( MaximumNumberElements < numberElements )
+		{
+			throw std::invalid_argument( "numberElements exceeds the width of MaskT" );
+		}
+
+		mNumberElements = numberElements;
+		mSubsetSize = subsetSize;
+	}
+
+	/**
+	 * Move constructor.
+	 * @param other R-Value to the BitmaskCombination to move.
+	 */
+	BitmaskCombination(
+		BitmaskCombination&& other )
+	{
+		_moveAssign( std::move( other ) );
+	}
+
+	/**
+	 * Copy constructor.
+	 * @param other Const reference to the BitmaskCombination to copy.
+	 */
+	BitmaskCombination(
+		const BitmaskCombination& other )
+	{
+		_copyAssign( other );
+	}
+
+	/**
+	 * Beginning iterator.
+	 * @return Iterator to the beginning of the combination enumeration.
+	 */
+	const_iterator begin() const
+	{
+		return const_iterator( false, mNumberElements, mSubsetSize );
+	}
+
+	/**
+	 * End iterator.
+	 * @return Iterator to the end of the combination enumeration.
+	 */
+	const_iterator end() const
+	{
+		return const_iterator( true, mNumberElements, mSubsetSize );
+	}
+
+	/**
+	 * The number of elements.
+	 * @return The number of elements.
+	 */
+	size_t numberElements() const
+	{
+		return mNumberElements;
+	}
+
+	/**
+	 * Move assignment operator.
+	 * @param other R-Value to the BitmaskCombination object to move to this instance.
+	 * @return Reference to this BitmaskCombination object is returned.
+	 */
+	BitmaskCombination& operator=(
+		BitmaskCombination&& other )
+	{
+		if ( this != &other )
+		{
+			_moveAssign( std::move( other ) );
+		}
+
+		return *this;
+	}
+
+	/**
+	 * Copy assignment operator.
+	 * @param other Const reference to the BitmaskCombination object to copy to this instance.
+	 * @return Reference to this BitmaskCombination object is returned.
+	 */
+	BitmaskCombination& operator=(
+		const BitmaskCombination& other )
+	{
+		if ( this != &other )
+		{
+			_copyAssign( other );
+		}
+
+		return *this;
+	}
+
+	/**
+	 * The number of elements to choose from.
+	 * @return The subset size.
+	 */
+	size_t subsetSize() const
+	{
+		return mSubsetSize;
+	}
+};
+
+template < typename MaskT >
+constexpr size_t BitmaskCombination< MaskT >::MaximumNumberElements;
+
+#if defined( __SIZEOF_INT128__ ) && !defined( COMBINATION_DISABLE_INT128 )
+/**
+ * BitmaskCombination for collections of up to 128 elements.
+ */
+using BitmaskCombination128 = BitmaskCombination< unsigned __int128 >;
+#endif
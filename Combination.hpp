@@ -5,11 +5,38 @@
  */
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+// The library feature macros are only defined once a standard header is
+// included, and <version> is the one that defines them all.
+#if defined( __has_include )
+#if __has_include( <version> )
+#include <version>
+#endif
+#endif
+
+#if defined( __cpp_lib_generator )
+#include <generator>
+#endif
+
+#if defined( __cpp_lib_ranges )
+#include <ranges>
+#endif
+
+#include "BinomialCoefficient.hpp"
+#include "CombinationCheckpoint.hpp"
+#include "CombinationStatistics.hpp"
+#include "Slice.hpp"
+
 /**
  * Class for enumerating over the subset combinations
  * of a set/vector/array/etc. While this class doesn't return the
@@ -26,29 +53,151 @@
  *             std::cout << " " << characters[ offset ]; }
  *         std::cout << std::endl; }
  *
+ * The offsets are stored as SizeT, which defaults to size_t. Narrower
+ * unsigned types (uint8_t, uint16_t, uint32_t) may be selected through
+ * BasicCombination to shrink the enumeration buffer when the number of
+ * elements is small, e.g. BasicCombination< uint8_t >( 40, 6 ).
+ *
+ * The iterators hold their enumeration in a std::vector< SizeT, Allocator >,
+ * so that for a large K, where copies of the iterator and the iterators
+ * of each slice allocate a buffer each, an allocator such as
+ * PoolAllocator can recycle those buffers rather than going to malloc.
+ *
+ * Besides stepping forward, the iterator steps backward and jumps by any
+ * offset, though it is declared a forward iterator, as what it refers to
+ * lives in the iterator itself. Jumping to an arbitrary rank uses the
+ * combinatorial number system, in O(K log N), which requires that the total number of
+ * subsets, N choose K, fits in a size_t; std::overflow_error is thrown
+ * otherwise. Plain forward iteration has no such limit.
+ *
  * Note:
  *   - Requires C++14 and above.
  */
-class Combination
+template < typename SizeT = size_t, typename Allocator = std::allocator< SizeT > >
+class BasicCombination
 {
+	static_assert( std::is_integral< SizeT >::value and std::is_unsigned< SizeT >::value,
+		"SizeT must be an unsigned integral type" );
+	static_assert( std::is_same< typename Allocator::value_type, SizeT >::value,
+		"Allocator must allocate SizeT" );
+
 private:
 	size_t mNumberElements;
 	size_t mSubsetSize;
 
 	void _copyAssign(
-		const Combination& other )
+		const BasicCombination& other )
 	{
 		mNumberElements = other.mNumberElements;
 		mSubsetSize = other.mSubsetSize;
 	}
 
 	void _moveAssign(
-		Combination&& other )
+		BasicCombination&& other )
 	{
 		mNumberElements = std::exchange( other.mNumberElements, 0 );
 		mSubsetSize = std::exchange( other.mSubsetSize, 0 );
 	}
 
+	static size_t _size(
+		size_t numberElements,
+		size_t subsetSize )
+	{
+		size_t count = 0;
+
+		if ( ( 0 < subsetSize ) and ( subsetSize <= numberElements )
+			and not binomialCoefficient( numberElements, subsetSize, count ) )
+		{
+			throw std::overflow_error( "number of subsets exceeds the range of size_t" );
+		}
+
+		return count;
+	}
+
+	// The first rank of part {index} of {parts} near equal parts of {total},
+	// where the leading total % parts parts each take one extra subset.
+	static size_t _partFirstRank(
+		size_t total,
+		size_t index,
+		size_t parts )
+	{
+		return index * ( total / parts ) + std::min( index, total % parts );
+	}
+
+	static size_t _rank(
+		size_t numberElements,
+		size_t subsetSize,
+		const SizeT* enumeration )
+	{
+		size_t rank = _size( numberElements, subsetSize ) - 1;
+
+		// The subsets following this one in lexicographic order are counted
+		// position by position, then subtracted from the last rank.
+		for ( size_t index = 0; index < subsetSize; ++index )
+		{
+			size_t count;
+			binomialCoefficient( numberElements - 1 - enumeration[ index ], subsetSize - index, count );
+			rank -= count;
+		}
+
+		return rank;
+	}
+
+	static void _unrank(
+		size_t numberElements,
+		size_t subsetSize,
+		size_t rank,
+		SizeT* enumeration )
+	{
+		size_t element = 0;
+
+		for ( size_t index = 0; index < subsetSize; ++index )
+		{
+			// Of the subsets continuing from element, those whose offset at this
+			// index is below e number C(N - element, K - index) - C(N - e, K - index),
+			// so binary search for the last e where that doesn't pass the rank.
+			size_t remaining = subsetSize - index;
+			size_t lower = element;
+			size_t upper = numberElements - remaining;
+			size_t total;
+			size_t count;
+			binomialCoefficient( numberElements - element, remaining, total );
+
+			while ( lower < upper )
+			{
+				size_t middle = upper - ( upper - lower ) / 2;
+				binomialCoefficient( numberElements - middle, remaining, count );
+
+				if ( total - count <= rank )
+				{
+					lower = middle;
+				}
+				else
+				{
+					upper = middle - 1;
+				}
+			}
+
+			binomialCoefficient( numberElements - lower, remaining, count );
+			rank -= total - count;
+			enumeration[ index ] = SizeT( lower );
+			element = lower + 1;
+		}
+	}
+
+#if defined( __cpp_lib_generator )
+	// Taking the combination by value copies it into the coroutine frame
+	// when the generator is created, rather than at the first resume.
+	static std::generator< const std::vector< SizeT, Allocator >& > _generate(
+		const BasicCombination combination )
+	{
+		for ( const auto& subset : combination )
+		{
+			co_yield subset;
+		}
+	}
+#endif
+
 public:
 	/**
 	 * Iterator class for enumerating over the subsets
@@ -57,12 +206,13 @@ public:
 	class const_iterator
 	{
 	private:
-		friend class Combination;
+		friend class BasicCombination;
 
 		bool mIsEnd;
 		size_t mNumberElements;
 		size_t mSubsetSize;
-		std::vector< size_t > mEnumeration;
+		size_t mChangedFrom;
+		std::vector< SizeT, Allocator > mEnumeration;
 
 		const_iterator(
 			bool end,
@@ -72,14 +222,17 @@ public:
 			mIsEnd = end;
 			mNumberElements = numberElements;
 			mSubsetSize = subsetSize;
+			mChangedFrom = 0;
 
-			if ( ( 0 < mSubsetSize ) and ( mSubsetSize <= mNumberElements ) )
+			// The end iterator is only ever tested against its flag,
+			// so there is no need to allocate an enumeration for it.
+			if ( not mIsEnd and ( 0 < mSubsetSize ) and ( mSubsetSize <= mNumberElements ) )
 			{
+				COMBINATION_STATISTIC( allocations, 1 );
 				mEnumeration.resize( mSubsetSize );
 
-				size_t offset = end * ( numberElements - mSubsetSize );
 				for ( size_t index( mSubsetSize ); index--;
-					mEnumeration[ index ] = offset + index );
+					mEnumeration[ index ] = SizeT( index ) );
 			}
 			else
 			{
@@ -90,10 +243,13 @@ public:
 		void _copyAssign(
 			const const_iterator& other )
 		{
+			COMBINATION_STATISTIC( copies, 1 );
+			COMBINATION_STATISTIC( allocations, mEnumeration.capacity() < other.mEnumeration.size() );
 			mIsEnd = other.mIsEnd;
 			mEnumeration = other.mEnumeration;
 			mNumberElements = other.mNumberElements;
 			mSubsetSize = other.mSubsetSize;
+			mChangedFrom = other.mChangedFrom;
 		}
 
 		void _moveAssign(
@@ -103,14 +259,74 @@ public:
 			mEnumeration = std::move( other.mEnumeration );
 			mNumberElements = std::exchange( other.mNumberElements, 0 );
 			mSubsetSize = std::exchange( other.mSubsetSize, 0 );
+			mChangedFrom = std::exchange( other.mChangedFrom, 0 );
+		}
+
+		// Bump the last offset before depth that isn't at its
+		// maximum, then pack the offsets following it.
+		void _advance(
+			size_t depth )
+		{
+			size_t index = depth;
+			for ( ; index-- && mEnumeration[ index ] == ( mNumberElements - mSubsetSize + index ); );
+
+			COMBINATION_STATISTIC( increments, 1 );
+			COMBINATION_STATISTIC( carries, depth - 1 - index );
+
+			if ( size_t( -1 ) != index )
+			{
+				mChangedFrom = index;
+
+				for ( mEnumeration[ index ]++; ++index < mEnumeration.size();
+					mEnumeration[ index ] = SizeT( mEnumeration[ index - 1 ] + 1 ) );
+			}
+			else
+			{
+				mChangedFrom = 0;
+				mIsEnd = true;
+			}
+		}
+
+		size_t _position() const
+		{
+			return mIsEnd ? _size( mNumberElements, mSubsetSize )
+				: _rank( mNumberElements, mSubsetSize, mEnumeration.data() );
+		}
+
+		void _seek(
+			size_t rank )
+		{
+			size_t count = _size( mNumberElements, mSubsetSize );
+
+			if ( count < rank )
+			{
+				throw std::out_of_range( "iterator moved outside of the enumeration" );
+			}
+
+			mIsEnd = ( count == rank );
+			mChangedFrom = 0;
+			COMBINATION_STATISTIC( seeks, 1 );
+
+			if ( not mIsEnd )
+			{
+				COMBINATION_STATISTIC( allocations, mEnumeration.capacity() < mSubsetSize );
+				mEnumeration.resize( mSubsetSize );
+				_unrank( mNumberElements, mSubsetSize, rank, mEnumeration.data() );
+			}
 		}
 
 	public:
+		// The iterator also moves backward and by any offset, but *it refers
+		// into its own buffer, so it is only advertised as a forward iterator:
+		// std::reverse_iterator and std::views::reverse dereference a temporary.
 		using iterator_category = std::forward_iterator_tag;
+#if defined( __cpp_lib_ranges )
+		using iterator_concept  = std::forward_iterator_tag;
+#endif
 		using difference_type   = std::ptrdiff_t;
-		using value_type        = const std::vector< size_t >;
-		using pointer           = const std::vector< size_t >*;
-		using reference         = const std::vector< size_t >&;
+		using value_type        = std::vector< SizeT, Allocator >;
+		using pointer           = const std::vector< SizeT, Allocator >*;
+		using reference         = const std::vector< SizeT, Allocator >&;
 
 		/**
 		 * Default constructor.
@@ -119,6 +335,7 @@ public:
 		{
 			mNumberElements = 0;
 			mSubsetSize = 0;
+			mChangedFrom = 0;
 			mIsEnd = true;
 		}
 
@@ -176,16 +393,26 @@ public:
 
 		/**
 		 * Equality operator.
+		 * Comparing against an end iterator only tests the end flags,
+		 * so the usual `it != combination.end()` check is constant time.
 		 * @param other Const reference to the iterator to compare against.
 		 * @return Return true if {@param other} compares equal to this iterator instance.
 		 */
 		bool operator==(
 			const const_iterator& other ) const
 		{
+			if ( mIsEnd or other.mIsEnd )
+			{
+				return ( mIsEnd == other.mIsEnd )
+					and ( mNumberElements == other.mNumberElements )
+					and ( mSubsetSize == other.mSubsetSize );
+			}
+
+			// The trailing offsets change most often, so compare from the back.
 			return ( mNumberElements == other.mNumberElements )
 				and ( mSubsetSize == other.mSubsetSize )
-				and ( mEnumeration == other.mEnumeration )
-				and ( mIsEnd == other.mIsEnd );
+				and ( mEnumeration.size() == other.mEnumeration.size() )
+				and std::equal( mEnumeration.rbegin(), mEnumeration.rend(), other.mEnumeration.rbegin() );
 		}
 
 		/**
@@ -217,6 +444,18 @@ public:
 			return mEnumeration;
 		}
 
+		/**
+		 * The lowest position of the enumeration modified by the last step.
+		 * Offsets before this position are unchanged, so computations cached
+		 * per prefix only need to redo positions from here on. For an iterator
+		 * fresh from begin(), or one moved by more than a single step, this is 0.
+		 * @return The lowest modified position.
+		 */
+		size_t changedFrom() const
+		{
+			return mChangedFrom;
+		}
+
 		/**
 		 * Post-increment operator.
 		 * @return iterator to the prior enumeration.
@@ -234,22 +473,381 @@ public:
 		 */
 		const_iterator& operator++()
 		{
+			_advance( mEnumeration.size() );
+			return *this;
+		}
+
+		/**
+		 * Skip over the remaining subsets sharing this subset's prefix,
+		 * moving to the next subset whose first {@param depth} offsets
+		 * differ. This prunes the whole subtree below the prefix at once,
+		 * rather than stepping through each of its subsets.
+		 * @param depth Length of the prefix to skip past. A depth of K or
+		 *     greater is a plain increment, while a depth of 0 moves to the end.
+		 * @return Reference to this iterator instance.
+		 */
+		const_iterator& skipPrefix(
+			size_t depth )
+		{
+			_advance( std::min( depth, mEnumeration.size() ) );
+			return *this;
+		}
+
+		/**
+		 * Post-decrement operator.
+		 * @return iterator to the prior enumeration.
+		 */
+		const_iterator operator--( int )
+		{
+			const_iterator previous( *this );
+			this->operator--();
+			return previous;
+		}
+
+		/**
+		 * Pre-decrement operator.
+		 * @return Reference to this iterator instance.
+		 */
+		const_iterator& operator--()
+		{
+			if ( mIsEnd )
+			{
+				if ( ( 0 < mSubsetSize ) and ( mSubsetSize <= mNumberElements ) )
+				{
+					mIsEnd = false;
+					mChangedFrom = 0;
+					COMBINATION_STATISTIC( allocations, mEnumeration.capacity() < mSubsetSize );
+					mEnumeration.resize( mSubsetSize );
+
+					for ( size_t index( mSubsetSize ); index--;
+						mEnumeration[ index ] = SizeT( mNumberElements - mSubsetSize + index ) );
+				}
+
+				return *this;
+			}
+
 			size_t index = mEnumeration.size();
-			for ( ; index-- && mEnumeration[ index ] == ( mNumberElements - mSubsetSize + index ); );
+			for ( ; index-- && mEnumeration[ index ] == ( index ? mEnumeration[ index - 1 ] + 1 : 0 ); );
 
 			if ( size_t( -1 ) != index )
 			{
-				for ( mEnumeration[ index ]++; ++index < mEnumeration.size();
-					mEnumeration[ index ] = mEnumeration[ index - 1 ] + 1 );
+				mChangedFrom = index;
+
+				for ( mEnumeration[ index ]--; ++index < mEnumeration.size();
+					mEnumeration[ index ] = SizeT( mNumberElements - mSubsetSize + index ) );
 			}
-			else
+
+			return *this;
+		}
+
+		/**
+		 * Addition assignment operator. Moving by more than one
+		 * subset unranks the target in O(K log N) rather than stepping.
+		 * @param offset Number of subsets to move forward by.
+		 * @return Reference to this iterator instance.
+		 * @throw std::out_of_range if the iterator would move outside of [begin, end].
+		 * @throw std::overflow_error if N choose K doesn't fit in a size_t.
+		 */
+		const_iterator& operator+=(
+			difference_type offset )
+		{
+			// Stepping by one increments in place, except from the end, where
+			// the checked path below throws.
+			if ( ( 1 == offset ) and not mIsEnd )
 			{
-				mIsEnd = true;
+				return this->operator++();
+			}
+
+			if ( 0 != offset )
+			{
+				size_t position = _position();
+
+				if ( ( offset < 0 ) and ( position < size_t( -offset ) ) )
+				{
+					throw std::out_of_range( "iterator moved outside of the enumeration" );
+				}
+
+				_seek( position + size_t( offset ) );
 			}
 
 			return *this;
 		}
 
+		/**
+		 * Subtraction assignment operator.
+		 * @param offset Number of subsets to move backward by.
+		 * @return Reference to this iterator instance.
+		 * @throw std::out_of_range if the iterator would move outside of [begin, end].
+		 * @throw std::overflow_error if N choose K doesn't fit in a size_t.
+		 */
+		const_iterator& operator-=(
+			difference_type offset )
+		{
+			return this->operator+=( -offset );
+		}
+
+		/**
+		 * Addition operator.
+		 * @param offset Number of subsets to move forward by.
+		 * @return Iterator {@param offset} subsets after this one.
+		 */
+		const_iterator operator+(
+			difference_type offset ) const
+		{
+			const_iterator iterator( *this );
+			iterator += offset;
+			return iterator;
+		}
+
+		/**
+		 * Addition operator.
+		 * @param offset Number of subsets to move forward by.
+		 * @param iterator Const reference to the iterator to move from.
+		 * @return Iterator {@param offset} subsets after {@param iterator}.
+		 */
+		friend const_iterator operator+(
+			difference_type offset,
+			const const_iterator& iterator )
+		{
+			return iterator + offset;
+		}
+
+		/**
+		 * Subtraction operator.
+		 * @param offset Number of subsets to move backward by.
+		 * @return Iterator {@param offset} subsets before this one.
+		 */
+		const_iterator operator-(
+			difference_type offset ) const
+		{
+			const_iterator iterator( *this );
+			iterator -= offset;
+			return iterator;
+		}
+
+		/**
+		 * Difference operator.
+		 * @param other Const reference to the iterator to measure from.
+		 * @return The number of subsets from {@param other} to this iterator.
+		 * @throw std::overflow_error if N choose K doesn't fit in a size_t.
+		 */
+		difference_type operator-(
+			const const_iterator& other ) const
+		{
+			return difference_type( _position() - other._position() );
+		}
+
+		/**
+		 * Subscript operator.
+		 * @param offset Number of subsets to move forward by.
+		 * @return Copy of the enumeration {@param offset} subsets after this one.
+		 */
+		value_type operator[](
+			difference_type offset ) const
+		{
+			return *( *this + offset );
+		}
+
+		/**
+		 * Less than operator.
+		 * @param other Const reference to the iterator to compare against.
+		 * @return Return true if this iterator precedes {@param other}.
+		 */
+		bool operator<(
+			const const_iterator& other ) const
+		{
+			return not mIsEnd and ( other.mIsEnd or ( mEnumeration < other.mEnumeration ) );
+		}
+
+		/**
+		 * Greater than operator.
+		 * @param other Const reference to the iterator to compare against.
+		 * @return Return true if this iterator follows {@param other}.
+		 */
+		bool operator>(
+			const const_iterator& other ) const
+		{
+			return other.operator<( *this );
+		}
+
+		/**
+		 * Less than or equal operator.
+		 * @param other Const reference to the iterator to compare against.
+		 * @return Return true if this iterator doesn't follow {@param other}.
+		 */
+		bool operator<=(
+			const const_iterator& other ) const
+		{
+			return not other.operator<( *this );
+		}
+
+		/**
+		 * Greater than or equal operator.
+		 * @param other Const reference to the iterator to compare against.
+		 * @return Return true if this iterator doesn't precede {@param other}.
+		 */
+		bool operator>=(
+			const const_iterator& other ) const
+		{
+			return not this->operator<( other );
+		}
+
+		/**
+		 * Write the next subsets into a caller provided buffer and advance
+		 * past them. The subsets are written contiguously, K offsets per
+		 * subset, starting with the subset this iterator refers to. Runs of
+		 * subsets that only differ in the last offset are written without
+		 * going through the increment. Afterwards, changedFrom() is the lowest
+		 * position modified by the whole batch, and is unchanged if nothing was written.
+		 * @param out Pointer to a buffer of at least {@param maxSubsets} * K offsets.
+		 * @param maxSubsets The largest number of subsets to write.
+		 * @return The number of subsets written, less than {@param maxSubsets} only at the end.
+		 */
+		size_t nextBatch(
+			SizeT* out,
+			size_t maxSubsets )
+		{
+			size_t count = 0;
+
+			// Nothing is written, so changedFrom() is left as it was.
+			if ( mIsEnd or ( 0 == maxSubsets ) )
+			{
+				return count;
+			}
+
+			const size_t last = mSubsetSize - 1;
+			SizeT* const enumeration = mEnumeration.data();
+			size_t changedFrom = last;
+
+			while ( ( count < maxSubsets ) and not mIsEnd )
+			{
+				size_t run = std::min( maxSubsets - count, mNumberElements - enumeration[ last ] );
+
+				for ( size_t offset = 0; offset < run; ++offset, out += mSubsetSize )
+				{
+					std::copy( enumeration, enumeration + last, out );
+					out[ last ] = SizeT( enumeration[ last ] + offset );
+				}
+
+				enumeration[ last ] = SizeT( enumeration[ last ] + run - 1 );
+				count += run;
+				this->operator++();
+				changedFrom = std::min( changedFrom, mChangedFrom );
+			}
+
+			mChangedFrom = changedFrom;
+			return count;
+		}
+
+		/**
+		 * Write the next subsets into a caller provided buffer as columns and
+		 * advance past them. Column j holds offset j of each of the subsets,
+		 * so that gathers over one position of a batch read contiguous memory.
+		 * Pair with AlignedAllocator::paddedSize for a stride that keeps each
+		 * column aligned.
+		 * @param out Pointer to a buffer of at least K * {@param columnStride} offsets.
+		 * @param maxSubsets The largest number of subsets to write.
+		 * @param columnStride Distance between the starts of consecutive columns, at least {@param maxSubsets}.
+		 * @return The number of subsets written, less than {@param maxSubsets} only at the end.
+		 */
+		size_t nextBatchColumns(
+			SizeT* out,
+			size_t maxSubsets,
+			size_t columnStride )
+		{
+			size_t count = 0;
+
+			// Nothing is written, so changedFrom() is left as it was.
+			if ( mIsEnd or ( 0 == maxSubsets ) )
+			{
+				return count;
+			}
+
+			const size_t last = mSubsetSize - 1;
+			SizeT* const enumeration = mEnumeration.data();
+			size_t changedFrom = last;
+
+			while ( ( count < maxSubsets ) and not mIsEnd )
+			{
+				size_t run = std::min( maxSubsets - count, mNumberElements - enumeration[ last ] );
+
+				for ( size_t index = 0; index < last; ++index )
+				{
+					std::fill_n( out + index * columnStride + count, run, enumeration[ index ] );
+				}
+
+				SizeT* column = out + last * columnStride + count;
+				for ( size_t offset = 0; offset < run; ++offset )
+				{
+					column[ offset ] = SizeT( enumeration[ last ] + offset );
+				}
+
+				enumeration[ last ] = SizeT( enumeration[ last ] + run - 1 );
+				count += run;
+				this->operator++();
+				changedFrom = std::min( changedFrom, mChangedFrom );
+			}
+
+			mChangedFrom = changedFrom;
+			return count;
+		}
+
+		/**
+		 * Write the next subsets into a caller provided buffer as columns of
+		 * length {@param maxSubsets} and advance past them.
+		 * @param out Pointer to a buffer of at least K * {@param maxSubsets} offsets.
+		 * @param maxSubsets The largest number of subsets to write.
+		 * @return The number of subsets written, less than {@param maxSubsets} only at the end.
+		 */
+		size_t nextBatchColumns(
+			SizeT* out,
+			size_t maxSubsets )
+		{
+			return nextBatchColumns( out, maxSubsets, maxSubsets );
+		}
+
+		/**
+		 * Recreate an iterator from a checkpoint taken by save, unranking its
+		 * subset in O(K log N) rather than stepping from the beginning.
+		 * @param checkpoint Const reference to the checkpoint to resume from.
+		 * @return Iterator at the checkpointed position, or the end iterator.
+		 * @throw std::invalid_argument if the offsets of N can't be represented by SizeT.
+		 * @throw std::out_of_range if the rank is past the end of the enumeration.
+		 * @throw std::overflow_error if N choose K doesn't fit in a size_t.
+		 */
+		static const_iterator resume(
+			const CombinationCheckpoint& checkpoint )
+		{
+			uint64_t numberElements = checkpoint.numberElements();
+
+			if ( ( std::numeric_limits< size_t >::max() < numberElements )
+				or ( std::numeric_limits< size_t >::max() < checkpoint.subsetSize() )
+				or ( ( 0 < numberElements ) and ( std::numeric_limits< SizeT >::max() < numberElements - 1 ) ) )
+			{
+				throw std::invalid_argument( "numberElements exceeds the range of SizeT" );
+			}
+
+			if ( std::numeric_limits< size_t >::max() < checkpoint.rank() )
+			{
+				throw std::out_of_range( "iterator moved outside of the enumeration" );
+			}
+
+			const_iterator iterator( true, size_t( numberElements ), size_t( checkpoint.subsetSize() ) );
+			iterator._seek( size_t( checkpoint.rank() ) );
+			return iterator;
+		}
+
+		/**
+		 * Checkpoint the position of this iterator, so that the enumeration can
+		 * be resumed from here after a restart. Ranking the subset is O(K).
+		 * @return Checkpoint of ( N, K, rank ), where the end has rank N choose K.
+		 * @throw std::overflow_error if N choose K doesn't fit in a size_t.
+		 */
+		CombinationCheckpoint save() const
+		{
+			return CombinationCheckpoint( mNumberElements, mSubsetSize, _position() );
+		}
+
 		/**
 		 * Swap this iterator with another.
 		 * @param other Reference to the iterator to swap with.
@@ -257,8 +855,10 @@ public:
 		void swap(
 			const_iterator& other )
 		{
+			std::swap( mIsEnd, other.mIsEnd );
 			std::swap( mNumberElements, other.mNumberElements );
 			std::swap( mSubsetSize, other.mSubsetSize );
+			std::swap( mChangedFrom, other.mChangedFrom );
 			std::swap( mEnumeration, other.mEnumeration );
 		}
 	};
@@ -267,11 +867,17 @@ public:
 	 * Default constructor.
 	 * @param numberElements Number of elements to choose from. [default: 0]
 	 * @param subsetSize Numer of element to choose. [default: 0]
+	 * @throw std::invalid_argument if the offsets of {@param numberElements} can't be represented by SizeT.
 	 */
-	Combination(
+	BasicCombination(
 		size_t numberElements = 0,
 		size_t subsetSize = 0 )
 	{
+		if ( ( 0 < numberElements ) and ( std::numeric_limits< SizeT >::max() < numberElements - 1 ) )
+		{
+			throw std::invalid_argument( "numberElements exceeds the range of SizeT" );
+		}
+
 		mNumberElements = numberElements;
 		mSubsetSize = subsetSize;
 	}
@@ -280,8 +886,8 @@ public:
 	 * Move constructor.
 	 * @param other R-Value to the Combination to move.
 	 */
-	Combination(
-		Combination&& other )
+	BasicCombination(
+		BasicCombination&& other )
 	{
 		_moveAssign( std::move( other ) );
 	}
@@ -290,12 +896,32 @@ public:
 	 * Copy constructor.
 	 * @param other Const reference to the Combination to copy.
 	 */
-	Combination(
-		const Combination& other )
+	BasicCombination(
+		const BasicCombination& other )
 	{
 		_copyAssign( other );
 	}
 
+	/**
+	 * The subset at the given rank of the enumeration.
+	 * @param rank Lexicographic rank of the subset, starting from 0.
+	 * @return Vector of offsets of the subset.
+	 * @throw std::out_of_range if {@param rank} isn't less than size().
+	 * @throw std::overflow_error if N choose K doesn't fit in a size_t.
+	 */
+	std::vector< SizeT > at(
+		size_t rank ) const
+	{
+		if ( size() <= rank )
+		{
+			throw std::out_of_range( "rank is outside of the enumeration" );
+		}
+
+		std::vector< SizeT > subset( mSubsetSize );
+		_unrank( mNumberElements, mSubsetSize, rank, subset.data() );
+		return subset;
+	}
+
 	/**
 	 * Beginning iterator.
 	 * @return Iterator to the beginning of the combination enumeration.
@@ -306,7 +932,24 @@ public:
 	}
 
 	/**
-	 * End iterator.
+	 * The enumeration without its first subsets. The first remaining subset
+	 * is found by unranking, in O(K log N), rather than by stepping over the
+	 * dropped subsets one at a time.
+	 * @param count Number of subsets to drop, at most size() are dropped.
+	 * @return Slice over the subsets of rank [count, size()).
+	 * @throw std::overflow_error if N choose K doesn't fit in a size_t.
+	 */
+	Slice< const_iterator > drop(
+		size_t count ) const
+	{
+		size_t total = size();
+		count = std::min( count, total );
+		return slice( count, total - count );
+	}
+
+	/**
+	 * End iterator. The end iterator doesn't hold an enumeration
+	 * and so never allocates.
 	 * @return Iterator to the end of the combination enumeration.
 	 */
 	const_iterator end() const
@@ -314,6 +957,18 @@ public:
 		return const_iterator( true, mNumberElements, mSubsetSize );
 	}
 
+#if defined( __cpp_lib_generator )
+	/**
+	 * Lazily generate the subsets as a coroutine, for pipelines built on
+	 * std::generator. The generator holds its own copy of the combination.
+	 * @return Generator yielding a const reference to each subset in turn.
+	 */
+	std::generator< const std::vector< SizeT, Allocator >& > generate() const
+	{
+		return _generate( *this );
+	}
+#endif
+
 	/**
 	 * The number of elements.
 	 * @return The number of elements.
@@ -328,8 +983,8 @@ public:
 	 * @param other R-Value to the Combination object to move to this instance.
 	 * @return Reference to this Combination object is returned.
 	 */
-	Combination& operator=(
-		Combination&& other )
+	BasicCombination& operator=(
+		BasicCombination&& other )
 	{
 		if ( this != &other )
 		{
@@ -344,8 +999,8 @@ public:
 	 * @param other Const reference to the Combination object to copy to this instance.
 	 * @return Reference to this Combination object is returned.
 	 */
-	Combination& operator=(
-		const Combination& other )
+	BasicCombination& operator=(
+		const BasicCombination& other )
 	{
 		if ( this != &other )
 		{
@@ -355,6 +1010,145 @@ public:
 		return *this;
 	}
 
+	/**
+	 * The rank of a subset within the enumeration.
+	 * @param subset Const reference to the strictly increasing offsets of the subset.
+	 * @return Lexicographic rank of {@param subset}, starting from 0.
+	 * @throw std::invalid_argument if {@param subset} isn't part of the enumeration.
+	 * @throw std::overflow_error if N choose K doesn't fit in a size_t.
+	 */
+	template < typename SubsetAllocator >
+	size_t rank(
+		const std::vector< SizeT, SubsetAllocator >& subset ) const
+	{
+		bool isSubset = ( 0 < mSubsetSize ) and ( subset.size() == mSubsetSize )
+			and ( subset.back() < mNumberElements );
+
+		for ( size_t index = 1; isSubset and ( index < subset.size() ); ++index )
+		{
+			isSubset = subset[ index - 1 ] < subset[ index ];
+		}
+
+		if ( not isSubset )
+		{
+			throw std::invalid_argument( "subset isn't part of the enumeration" );
+		}
+
+		return _rank( mNumberElements, mSubsetSize, subset.data() );
+	}
+
+	/**
+	 * The rank of a subset within the enumeration, taking a braced list of offsets.
+	 * @param subset Const reference to the strictly increasing offsets of the subset.
+	 * @return Lexicographic rank of {@param subset}, starting from 0.
+	 * @throw std::invalid_argument if {@param subset} isn't part of the enumeration.
+	 * @throw std::overflow_error if N choose K doesn't fit in a size_t.
+	 */
+	size_t rank(
+		const std::vector< SizeT >& subset ) const
+	{
+		return rank< std::allocator< SizeT > >( subset );
+	}
+
+	/**
+	 * One shard of the enumeration, for fanning it out over independent
+	 * workers or nodes. The shards are the slices of split( shardCount ),
+	 * but each is found on its own by unranking its two boundaries, so
+	 * no worker iterates past the shards before its own. Concatenating
+	 * the shards in index order gives the whole enumeration.
+	 * @param shardIndex Index of the shard, from 0.
+	 * @param shardCount Number of shards the enumeration is divided into.
+	 * @return Slice over the subsets of shard {@param shardIndex}, whose size differs from the others by at most one.
+	 * @throw std::invalid_argument if {@param shardIndex} isn't less than {@param shardCount}.
+	 * @throw std::overflow_error if N choose K doesn't fit in a size_t.
+	 */
+	Slice< const_iterator > shard(
+		size_t shardIndex,
+		size_t shardCount ) const
+	{
+		if ( shardCount <= shardIndex )
+		{
+			throw std::invalid_argument( "shardIndex must be less than shardCount" );
+		}
+
+		size_t total = size();
+		size_t firstRank = _partFirstRank( total, shardIndex, shardCount );
+		return slice( firstRank, _partFirstRank( total, shardIndex + 1, shardCount ) - firstRank );
+	}
+
+	/**
+	 * The total number of subsets, N choose K.
+	 * @return The number of subsets in the enumeration.
+	 * @throw std::overflow_error if N choose K doesn't fit in a size_t.
+	 */
+	size_t size() const
+	{
+		return _size( mNumberElements, mSubsetSize );
+	}
+
+	/**
+	 * A contiguous sub-range of the enumeration. Setting up the slice
+	 * unranks its two boundaries, rather than stepping to them.
+	 * @param firstRank Rank of the first subset of the slice.
+	 * @param count Number of subsets in the slice.
+	 * @return Slice over the subsets of rank [firstRank, firstRank + count).
+	 * @throw std::out_of_range if the slice extends past the end of the enumeration.
+	 * @throw std::overflow_error if N choose K doesn't fit in a size_t.
+	 */
+	Slice< const_iterator > slice(
+		size_t firstRank,
+		size_t count ) const
+	{
+		size_t total = size();
+
+		if ( ( total < firstRank ) or ( total - firstRank < count ) )
+		{
+			throw std::out_of_range( "slice is outside of the enumeration" );
+		}
+
+		const_iterator first = end();
+		const_iterator last = end();
+		first._seek( firstRank );
+		last._seek( firstRank + count );
+
+		return Slice< const_iterator >( std::move( first ), std::move( last ), firstRank, count );
+	}
+
+	/**
+	 * Partition the enumeration into contiguous slices of near equal size,
+	 * in order, such that the sizes differ by at most one.
+	 * @param parts Number of slices to partition into.
+	 * @return Vector of {@param parts} slices covering the whole enumeration.
+	 * @throw std::overflow_error if N choose K doesn't fit in a size_t.
+	 */
+	std::vector< Slice< const_iterator > > split(
+		size_t parts ) const
+	{
+		std::vector< Slice< const_iterator > > slices;
+		size_t total = size();
+
+		if ( 0 == parts )
+		{
+			return slices;
+		}
+
+		slices.reserve( parts );
+		const_iterator first = begin();
+
+		for ( size_t part = 0; part < parts; ++part )
+		{
+			size_t firstRank = _partFirstRank( total, part, parts );
+			size_t count = _partFirstRank( total, part + 1, parts ) - firstRank;
+			const_iterator last = end();
+			last._seek( firstRank + count );
+
+			slices.push_back( Slice< const_iterator >( std::move( first ), last, firstRank, count ) );
+			first = std::move( last );
+		}
+
+		return slices;
+	}
+
 	/**
 	 * The number of elements to choose from.
 	 * @return The subset size.
@@ -364,3 +1158,27 @@ public:
 		return mSubsetSize;
 	}
 };
+
+/**
+ * Combination enumerating size_t offsets.
+ */
+using Combination = BasicCombination<>;
+
+#if defined( __cpp_lib_ranges )
+/**
+ * BasicCombination is a forward view, as it is cheap to copy and its
+ * iterators hold all of their own state, which also lets them outlive the
+ * combination.
+ */
+namespace std
+{
+namespace ranges
+{
+template < typename SizeT, typename Allocator >
+inline constexpr bool enable_view< BasicCombination< SizeT, Allocator > > = true;
+
+template < typename SizeT, typename Allocator >
+inline constexpr bool enable_borrowed_range< BasicCombination< SizeT, Allocator > > = true;
+}
+}
+#endif
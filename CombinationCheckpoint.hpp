@@ -0,0 +1,146 @@
+/**
+ * Copyright ©2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "Varint.hpp"
+
+/**
+ * Class holding the position of a Combination iterator as the triple
+ * ( N, K, rank ), as returned by Combination::const_iterator::save. The
+ * checkpoint is independent of the offset type, and serializes to at most
+ * 30 bytes, with each value written as a variable length integer.
+ *
+ * As an example of use:
+ *     Combination combination( 60, 8 );
+ *     auto iterator = Combination::const_iterator::resume(
+ *         CombinationCheckpoint::deserialize( bytes.data(), bytes.size() ) );
+ *     for ( ; iterator != combination.end(); ++iterator ) {
+ *         process( *iterator );
+ *         if ( preempted() ) {
+ *             store( iterator.save().serialize() ); break; } }
+ *
+ * Note:
+ *   - Requires C++14 and above.
+ */
+class CombinationCheckpoint
+{
+private:
+	uint64_t mNumberElements;
+	uint64_t mRank;
+	uint64_t mSubsetSize;
+
+public:
+	/**
+	 * Default constructor, the position of an empty enumeration.
+	 * @param numberElements Number of elements to choose from. [default: 0]
+	 * @param subsetSize Number of elements to choose. [default: 0]
+	 * @param rank Lexicographic rank of the subset, where N choose K is the end. [default: 0]
+	 */
+	CombinationCheckpoint(
+		uint64_t numberElements = 0,
+		uint64_t subsetSize = 0,
+		uint64_t rank = 0 )
+	{
+		mNumberElements = numberElements;
+		mRank = rank;
+		mSubsetSize = subsetSize;
+	}
+
+	/**
+	 * Read a checkpoint back from the bytes written by serialize.
+	 * @param data Const pointer to the serialized checkpoint.
+	 * @param length Number of bytes at {@param data}.
+	 * @return The checkpoint.
+	 * @throw std::invalid_argument if the bytes aren't exactly one serialized checkpoint.
+	 */
+	static CombinationCheckpoint deserialize(
+		const uint8_t* data,
+		size_t length )
+	{
+		const uint8_t* last = data + length;
+		uint64_t numberElements = readVarint( data, last );
+		uint64_t subsetSize = readVarint( data, last );
+		uint64_t rank = readVarint( data, last );
+
+		if ( data != last )
+		{
+			throw std::invalid_argument( "checkpoint is followed by trailing bytes" );
+		}
+
+		return CombinationCheckpoint( numberElements, subsetSize, rank );
+	}
+
+	/**
+	 * The number of elements.
+	 * @return The number of elements.
+	 */
+	uint64_t numberElements() const
+	{
+		return mNumberElements;
+	}
+
+	/**
+	 * Equality operator.
+	 * @param other Const reference to the checkpoint to compare against.
+	 * @return Return true if {@param other} holds the same position.
+	 */
+	bool operator==(
+		const CombinationCheckpoint& other ) const
+	{
+		return ( mNumberElements == other.mNumberElements )
+			and ( mRank == other.mRank )
+			and ( mSubsetSize == other.mSubsetSize );
+	}
+
+	/**
+	 * Inequality operator.
+	 * @param other Const reference to the checkpoint to compare against.
+	 * @return Return true if {@param other} holds a different position.
+	 */
+	bool operator!=(
+		const CombinationCheckpoint& other ) const
+	{
+		return not this->operator==( other );
+	}
+
+	/**
+	 * The rank of the subset, where N choose K marks the end.
+	 * @return The lexicographic rank.
+	 */
+	uint64_t rank() const
+	{
+		return mRank;
+	}
+
+	/**
+	 * Write the checkpoint as three variable length integers, N then K then
+	 * the rank, taking a byte per seven bits of each.
+	 * @return Vector of between 3 and 30 bytes.
+	 */
+	std::vector< uint8_t > serialize() const
+	{
+		std::vector< uint8_t > bytes;
+		bytes.reserve( 30 );
+		writeVarint( bytes, mNumberElements );
+		writeVarint( bytes, mSubsetSize );
+		writeVarint( bytes, mRank );
+		return bytes;
+	}
+
+	/**
+	 * The number of elements to choose.
+	 * @return The subset size.
+	 */
+	uint64_t subsetSize() const
+	{
+		return mSubsetSize;
+	}
+};
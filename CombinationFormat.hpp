@@ -0,0 +1,250 @@
+/**
+ * Copyright ©2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+/**
+ * The record layouts of a packed enumeration, as written by
+ * CombinationWriter and read back by CombinationReader.
+ *
+ *   - Indices: each subset is K offsets of indexWidth( N ) bytes each.
+ *   - Bitmask: each subset is a mask of ( N + 7 ) / 8 bytes, where bit i
+ *     is set if offset i is in the subset.
+ *   - Delta: each subset is the length of the prefix it shares with the
+ *     previous subset, followed by the gaps between its remaining offsets,
+ *     as variable length integers. Every DeltaKeyframeInterval-th subset
+ *     shares no prefix, so that it can be decoded on its own.
+ *
+ * Every value is written little endian, so files are portable between hosts.
+ */
+enum class CombinationFormat : uint8_t
+{
+	Indices = 0,
+	Bitmask = 1,
+	Delta = 2
+};
+
+/**
+ * Class for the fixed size header at the start of a packed enumeration.
+ *
+ * The header is laid out as:
+ *     bytes  0 ..  3  magic, "CMBN"
+ *     byte   4        version
+ *     byte   5        CombinationFormat
+ *     bytes  6 ..  7  reserved, zero
+ *     bytes  8 .. 15  N
+ *     bytes 16 .. 23  K
+ *     bytes 24 .. 31  rank of the first subset within the enumeration of ( N, K )
+ *
+ * Note:
+ *   - Requires C++14 and above.
+ */
+class CombinationFileHeader
+{
+private:
+	uint64_t mFirstRank;
+	CombinationFormat mFormat;
+	uint64_t mNumberElements;
+	uint64_t mSubsetSize;
+
+	static void _store(
+		uint8_t* out,
+		uint64_t value )
+	{
+		for ( size_t index = 0; index < 8; ++index, value >>= 8 )
+		{
+			out[ index ] = uint8_t( value );
+		}
+	}
+
+	static uint64_t _load(
+		const uint8_t* in )
+	{
+		uint64_t value = 0;
+
+		for ( size_t index = 8; index--; )
+		{
+			value = ( value << 8 ) | in[ index ];
+		}
+
+		return value;
+	}
+
+public:
+	/**
+	 * The size of the header in bytes.
+	 */
+	static constexpr size_t Size = 32;
+
+	/**
+	 * The version of the layout written.
+	 */
+	static constexpr uint8_t Version = 1;
+
+	/**
+	 * The number of subsets from one keyframe of the Delta format to the next.
+	 */
+	static constexpr size_t DeltaKeyframeInterval = 256;
+
+	/**
+	 * Default constructor.
+	 * @param numberElements Number of elements to choose from. [default: 0]
+	 * @param subsetSize Number of elements to choose. [default: 0]
+	 * @param format The record layout. [default: CombinationFormat::Indices]
+	 * @param firstRank Rank of the first subset within the enumeration. [default: 0]
+	 */
+	CombinationFileHeader(
+		uint64_t numberElements = 0,
+		uint64_t subsetSize = 0,
+		CombinationFormat format = CombinationFormat::Indices,
+		uint64_t firstRank = 0 )
+	{
+		mFirstRank = firstRank;
+		mFormat = format;
+		mNumberElements = numberElements;
+		mSubsetSize = subsetSize;
+	}
+
+	/**
+	 * Read a header.
+	 * @param data Const pointer to the start of the packed enumeration.
+	 * @param length Number of bytes at {@param data}.
+	 * @return The header.
+	 * @throw std::invalid_argument if the bytes don't start with a header of a known version and format,
+	 *        if the first record wouldn't fit in the bytes after the header, or if records follow a header
+	 *        with K greater than N, which is an empty enumeration.
+	 */
+	static CombinationFileHeader decode(
+		const uint8_t* data,
+		size_t length )
+	{
+		if ( ( length < Size ) or ( 'C' != data[ 0 ] ) or ( 'M' != data[ 1 ] ) or ( 'B' != data[ 2 ] ) or ( 'N' != data[ 3 ] ) )
+		{
+			throw std::invalid_argument( "data doesn't start with a combination header" );
+		}
+
+		if ( Version != data[ 4 ] )
+		{
+			throw std::invalid_argument( "combination header is of an unknown version" );
+		}
+
+		if ( uint8_t( CombinationFormat::Delta ) < data[ 5 ] )
+		{
+			throw std::invalid_argument( "combination header is of an unknown format" );
+		}
+
+		CombinationFileHeader header( _load( data + 8 ), _load( data + 16 ),
+			CombinationFormat( data[ 5 ] ), _load( data + 24 ) );
+
+		size_t remaining = length - Size;
+
+		if ( ( ( std::numeric_limits< size_t >::max() / header.indexWidth() ) < header.mSubsetSize )
+			or ( ( header.mNumberElements < header.mSubsetSize ) and ( 0 < remaining ) ) )
+		{
+			throw std::invalid_argument( "combination header has an invalid subset size" );
+		}
+
+		// A Delta record takes at least a byte for its prefix and one per offset
+		// after it, and the first record, a keyframe, has no prefix to share.
+		uint64_t firstRecord = ( CombinationFormat::Delta == header.mFormat ) ? header.mSubsetSize + 1 : header.recordSize();
+
+		if ( ( 0 < remaining ) and ( remaining < firstRecord ) )
+		{
+			throw std::invalid_argument( "combination header doesn't fit the data" );
+		}
+
+		return header;
+	}
+
+	/**
+	 * Write the header.
+	 * @param out Pointer to a buffer of at least Size bytes.
+	 */
+	void encode(
+		uint8_t* out ) const
+	{
+		out[ 0 ] = 'C';
+		out[ 1 ] = 'M';
+		out[ 2 ] = 'B';
+		out[ 3 ] = 'N';
+		out[ 4 ] = Version;
+		out[ 5 ] = uint8_t( mFormat );
+		out[ 6 ] = 0;
+		out[ 7 ] = 0;
+		_store( out + 8, mNumberElements );
+		_store( out + 16, mSubsetSize );
+		_store( out + 24, mFirstRank );
+	}
+
+	/**
+	 * The rank of the first subset within the enumeration of ( N, K ).
+	 * @return The rank of the first subset.
+	 */
+	uint64_t firstRank() const
+	{
+		return mFirstRank;
+	}
+
+	/**
+	 * The record layout.
+	 * @return The format.
+	 */
+	CombinationFormat format() const
+	{
+		return mFormat;
+	}
+
+	/**
+	 * The width of an offset in the Indices format, the fewest bytes
+	 * of 1, 2, 4 or 8 that hold N - 1.
+	 * @return The number of bytes per offset.
+	 */
+	size_t indexWidth() const
+	{
+		return ( mNumberElements <= ( uint64_t( 1 ) << 8 ) ) ? 1
+			: ( mNumberElements <= ( uint64_t( 1 ) << 16 ) ) ? 2
+			: ( mNumberElements <= ( uint64_t( 1 ) << 32 ) ) ? 4 : 8;
+	}
+
+	/**
+	 * The number of elements.
+	 * @return The number of elements.
+	 */
+	uint64_t numberElements() const
+	{
+		return mNumberElements;
+	}
+
+	/**
+	 * The size of a subset in the fixed width formats.
+	 * @return The number of bytes per subset, or 0 for the Delta format.
+	 */
+	size_t recordSize() const
+	{
+		switch ( mFormat )
+		{
+		case CombinationFormat::Indices:
+			return size_t( mSubsetSize ) * indexWidth();
+		case CombinationFormat::Bitmask:
+			return size_t( ( mNumberElements + 7 ) / 8 );
+		default:
+			return 0;
+		}
+	}
+
+	/**
+	 * The number of elements to choose.
+	 * @return The subset size.
+	 */
+	uint64_t subsetSize() const
+	{
+		return mSubsetSize;
+	}
+};
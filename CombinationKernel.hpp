@@ -0,0 +1,207 @@
+/**
+ * Copyright ©2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#pragma once
+
+#include <cstdint>
+
+// Qualifier of the kernel functions, so they compile for the device as well
+// as the host. Under nvcc or hipcc they are __host__ __device__; define it
+// beforehand to override, such as to SYCL_EXTERNAL.
+#if !defined( COMBINATION_DEVICE )
+#if defined( __CUDACC__ ) || defined( __HIPCC__ )
+#define COMBINATION_DEVICE __host__ __device__
+#else
+#define COMBINATION_DEVICE
+#endif
+#endif
+
+/**
+ * Free functions for enumerating subsets of K of N elements from within
+ * device code, in the same lexicographic order and as the same strictly
+ * increasing offsets as Combination's iterator. Each device thread unranks
+ * the first subset of its own range of ranks and steps through the rest,
+ * so no subsets are enumerated on the host or copied over.
+ *
+ * The functions take only integers and a caller provided buffer of K
+ * offsets: they don't allocate, throw, use the Pascal triangle or call into
+ * the standard library, so they serve CUDA and HIP kernels, SYCL kernels
+ * and OpenMP target regions alike. For OpenMP, include the header between
+ * "#pragma omp declare target" and "#pragma omp end declare target".
+ *
+ * As an example of use, in a CUDA kernel:
+ *     uint64_t rank = uint64_t( blockIdx.x ) * blockDim.x + threadIdx.x;
+ *     uint8_t subset[ 6 ];
+ *     if ( unrankCombination( 40, 6, rank * perThread, subset ) ) {
+ *         uint64_t step = 0;
+ *         do { evaluate( subset ); }
+ *         while ( ( ++step < perThread ) and nextCombination( 40, 6, subset ) ); }
+ *
+ * Note:
+ *   - Requires C++14 and above.
+ */
+
+/**
+ * Compute ( {@param value} * {@param factor} ) / {@param divisor}, where the
+ * quotient is known to be exact, without the product overflowing along the way.
+ * @param value The value to scale.
+ * @param factor The multiplier.
+ * @param divisor The divisor, dividing {@param value} * {@param factor}.
+ * @return The exact quotient.
+ */
+COMBINATION_DEVICE inline uint64_t combinationScaleExact(
+	uint64_t value,
+	uint64_t factor,
+	uint64_t divisor )
+{
+	// With g = gcd( value, divisor ), divisor / g is coprime to value / g,
+	// so it must divide factor.
+	uint64_t a = value;
+	uint64_t b = divisor;
+
+	while ( b )
+	{
+		uint64_t remainder = a % b;
+		a = b;
+		b = remainder;
+	}
+
+	return ( value / a ) * ( factor / ( divisor / a ) );
+}
+
+/**
+ * Compute the number of subsets Combination enumerates, N choose K for
+ * 0 < K <= N and 0 otherwise.
+ * @param numberElements Number of elements to choose from.
+ * @param subsetSize Number of elements to choose.
+ * @param count Reference to write the number of subsets to.
+ * @return True if the count fits in a uint64_t, false if it overflowed.
+ */
+COMBINATION_DEVICE inline bool combinationCount(
+	uint64_t numberElements,
+	uint64_t subsetSize,
+	uint64_t& count )
+{
+	count = 0;
+
+	if ( ( 0 == subsetSize ) or ( numberElements < subsetSize ) )
+	{
+		return true;
+	}
+
+	uint64_t k = ( numberElements - subsetSize < subsetSize ) ? numberElements - subsetSize : subsetSize;
+	count = 1;
+
+	for ( uint64_t index = 1; index <= k; ++index )
+	{
+		// C(n - k + i, i) = C(n - k + i - 1, i - 1) * ( n - k + i ) / i, once the
+		// divisor is cancelled, overflows only when the coefficient itself does.
+		uint64_t factor = numberElements - k + index;
+		uint64_t a = count;
+		uint64_t b = index;
+
+		while ( b )
+		{
+			uint64_t remainder = a % b;
+			a = b;
+			b = remainder;
+		}
+
+		uint64_t reduced = count / a;
+		factor /= ( index / a );
+
+		if ( ( ~uint64_t( 0 ) / factor ) < reduced )
+		{
+			return false;
+		}
+
+		count = reduced * factor;
+	}
+
+	return true;
+}
+
+/**
+ * Write the subset at {@param rank} of the enumeration of K of N elements,
+ * the same subset as Combination( N, K ).at( rank ). The coefficients are
+ * stepped along from C(N - 1, K - 1) rather than looked up, in O(N) steps.
+ * @param numberElements Number of elements to choose from.
+ * @param subsetSize Number of elements to choose.
+ * @param rank The rank of the subset.
+ * @param out Pointer to a buffer of at least K offsets.
+ * @return True if the subset was written. False, leaving {@param out} untouched,
+ *         if {@param rank} is past the enumeration or N choose K doesn't fit in a uint64_t.
+ */
+template < typename SizeT >
+COMBINATION_DEVICE bool unrankCombination(
+	uint64_t numberElements,
+	uint64_t subsetSize,
+	uint64_t rank,
+	SizeT* out )
+{
+	uint64_t total;
+
+	if ( ( not combinationCount( numberElements, subsetSize, total ) ) or ( total <= rank ) )
+	{
+		return false;
+	}
+
+	// {count} is C(n, k), the number of subsets continuing with {element} at
+	// {index}, where n = N - 1 - element and k = K - 1 - index. Every such
+	// coefficient is at most N choose K, so it fits.
+	uint64_t n = numberElements - 1;
+	uint64_t k = subsetSize - 1;
+	uint64_t count = combinationScaleExact( total, subsetSize, numberElements );
+	uint64_t element = 0;
+
+	for ( uint64_t index = 0; index < subsetSize; ++element, --n )
+	{
+		if ( rank < count )
+		{
+			out[ index++ ] = SizeT( element );
+
+			if ( 0 < n )
+			{
+				count = combinationScaleExact( count, k, n );
+			}
+
+			--k;
+		}
+		else
+		{
+			rank -= count;
+			count = combinationScaleExact( count, n - k, n );
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Step {@param subset} to the next subset of the enumeration of K of N
+ * elements, as the increment of Combination's iterator does.
+ * @param numberElements Number of elements to choose from.
+ * @param subsetSize Number of elements to choose.
+ * @param subset Pointer to the K strictly increasing offsets of the subset.
+ * @return True if {@param subset} was stepped. False, leaving it untouched, if it was the last subset.
+ */
+template < typename SizeT >
+COMBINATION_DEVICE bool nextCombination(
+	uint64_t numberElements,
+	uint64_t subsetSize,
+	SizeT* subset )
+{
+	uint64_t index = subsetSize;
+	for ( ; index-- and ( uint64_t( subset[ index ] ) == ( numberElements - subsetSize + index ) ); );
+
+	if ( ~uint64_t( 0 ) == index )
+	{
+		return false;
+	}
+
+	for ( subset[ index ]++; ++index < subsetSize; subset[ index ] = SizeT( subset[ index - 1 ] + 1 ) );
+
+	return true;
+}
@@ -0,0 +1,540 @@
+/**
+ * Copyright ©2021-2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "BinomialCoefficient.hpp"
+#include "Combination.hpp"
+#include "Slice.hpp"
+
+/**
+ * Class for enumerating over every ordering of every subset combination of
+ * a collection: each subset of Combination( N, K ), in the same order, is
+ * followed by all K! of its orderings in lexicographic order. This fuses the
+ * common pattern of copying each subset and calling std::next_permutation on
+ * the copy; here the orderings are generated in place in the iterator's own
+ * buffer, and once an ordering wraps back around to the sorted subset the
+ * same buffer steps on to the next subset.
+ *
+ * As an example of use:
+ *     CombinationPermutation<> combination( 6, 3 );
+ *     for ( const auto& ordering : combination ) {
+ *         process( ordering ); }
+ *
+ * The same ordered selections as Permutation( N, K ) are produced, with
+ * the subsets grouped together. The rank of an ordering is the rank of its
+ * subset times K! plus the Lehmer code of the ordering, giving size(), at(),
+ * rank() and slice(), so the enumeration can be split across threads.
+ * Those throw std::overflow_error once the count doesn't fit in a size_t,
+ * while iterating from begin() works for any N and K.
+ *
+ * Note:
+ *   - Requires C++14 and above.
+ */
+template < typename SizeT = size_t >
+class CombinationPermutation
+{
+	static_assert( std::is_integral< SizeT >::value and std::is_unsigned< SizeT >::value,
+		"SizeT must be an unsigned integral type" );
+
+private:
+	size_t mNumberElements;
+	size_t mSubsetSize;
+
+	void _copyAssign(
+		const CombinationPermutation& other )
+	{
+		mNumberElements = other.mNumberElements;
+		mSubsetSize = other.mSubsetSize;
+	}
+
+	void _moveAssign(
+		CombinationPermutation&& other )
+	{
+		mNumberElements = std::exchange( other.mNumberElements, 0 );
+		mSubsetSize = std::exchange( other.mSubsetSize, 0 );
+	}
+
+	static size_t _size(
+		size_t numberElements,
+		size_t subsetSize )
+	{
+		size_t count = 0;
+
+		if ( ( 0 < subsetSize ) and ( subsetSize <= numberElements )
+			and not fallingFactorial( numberElements, subsetSize, count ) )
+		{
+			throw std::overflow_error( "number of selections exceeds the range of size_t" );
+		}
+
+		return count;
+	}
+
+	// Only for ranks already checked against size(), so K! fits.
+	static void _unrank(
+		size_t numberElements,
+		size_t subsetSize,
+		size_t rank,
+		SizeT* enumeration )
+	{
+		size_t orderings;
+		fallingFactorial( subsetSize, subsetSize, orderings );
+
+		std::vector< SizeT > subset = BasicCombination< SizeT >( numberElements, subsetSize ).at( rank / orderings );
+		rank %= orderings;
+
+		// Decode the Lehmer code, choosing each offset from those remaining in the subset.
+		for ( size_t index = 0; index < subsetSize; ++index )
+		{
+			orderings /= subsetSize - index;
+			size_t digit = rank / orderings;
+			rank %= orderings;
+
+			enumeration[ index ] = subset[ digit ];
+			subset.erase( subset.begin() + digit );
+		}
+	}
+
+public:
+	/**
+	 * Iterator class for enumerating over the orderings
+	 * of the subsets of a collection.
+	 */
+	class const_iterator
+	{
+	private:
+		friend class CombinationPermutation;
+
+		bool mIsEnd;
+		size_t mNumberElements;
+		size_t mSubsetSize;
+		std::vector< SizeT > mEnumeration;
+
+		const_iterator(
+			bool end,
+			size_t numberElements,
+			size_t subsetSize,
+			size_t rank )
+		{
+			mIsEnd = end;
+			mNumberElements = numberElements;
+			mSubsetSize = subsetSize;
+
+			if ( not mIsEnd and ( 0 < mSubsetSize ) and ( mSubsetSize <= mNumberElements ) )
+			{
+				mEnumeration.resize( mSubsetSize );
+
+				// The first ordering is the first subset, sorted, whatever the size.
+				if ( 0 == rank )
+				{
+					std::iota( mEnumeration.begin(), mEnumeration.end(), SizeT( 0 ) );
+				}
+				else
+				{
+					_unrank( mNumberElements, mSubsetSize, rank, mEnumeration.data() );
+				}
+			}
+			else
+			{
+				mIsEnd = true;
+			}
+		}
+
+		void _copyAssign(
+			const const_iterator& other )
+		{
+			mIsEnd = other.mIsEnd;
+			mNumberElements = other.mNumberElements;
+			mSubsetSize = other.mSubsetSize;
+			mEnumeration = other.mEnumeration;
+		}
+
+		void _moveAssign(
+			const_iterator&& other )
+		{
+			mIsEnd = std::exchange( other.mIsEnd, true );
+			mNumberElements = std::exchange( other.mNumberElements, 0 );
+			mSubsetSize = std::exchange( other.mSubsetSize, 0 );
+			mEnumeration = std::move( other.mEnumeration );
+		}
+
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using difference_type   = std::ptrdiff_t;
+		using value_type        = const std::vector< SizeT >;
+		using pointer           = const std::vector< SizeT >*;
+		using reference         = const std::vector< SizeT >&;
+
+		/**
+		 * Default constructor.
+		 */
+		const_iterator()
+		{
+			mIsEnd = true;
+			mNumberElements = 0;
+			mSubsetSize = 0;
+		}
+
+		/**
+		 * Move constructor.
+		 * @param other R-Value to the iterator to move.
+		 */
+		const_iterator(
+			const_iterator&& other )
+		{
+			_moveAssign( std::move( other ) );
+		}
+
+		/**
+		 * Copy constructor.
+		 * @param other Const reference to the iterator to copy.
+		 */
+		const_iterator(
+			const const_iterator& other )
+		{
+			_copyAssign( other );
+		}
+
+		/**
+		 * Move assignment.
+		 * @param other R-Value to the iterator to move.
+		 * @return Reference to this iterator instance.
+		 */
+		const_iterator& operator=(
+			const_iterator&& other )
+		{
+			if ( this != &other )
+			{
+				_moveAssign( std::move( other ) );
+			}
+
+			return *this;
+		}
+
+		/**
+		 * Copy assignment.
+		 * @param other Const reference to the iterator to copy.
+		 * @return Reference to this iterator instance.
+		 */
+		const_iterator& operator=(
+			const const_iterator& other )
+		{
+			if ( this != &other )
+			{
+				_copyAssign( other );
+			}
+
+			return *this;
+		}
+
+		/**
+		 * Equality operator.
+		 * Comparing against an end iterator only tests the end flags.
+		 * @param other Const reference to the iterator to compare against.
+		 * @return Return true if {@param other} compares equal to this iterator instance.
+		 */
+		bool operator==(
+			const const_iterator& other ) const
+		{
+			if ( mIsEnd or other.mIsEnd )
+			{
+				return ( mIsEnd == other.mIsEnd )
+					and ( mNumberElements == other.mNumberElements )
+					and ( mSubsetSize == other.mSubsetSize );
+			}
+
+			return ( mNumberElements == other.mNumberElements )
+				and ( mSubsetSize == other.mSubsetSize )
+				and std::equal( mEnumeration.rbegin(), mEnumeration.rend(), other.mEnumeration.rbegin() );
+		}
+
+		/**
+		 * Inequality operator.
+		 * @param other Const reference to the iterator to compare against.
+		 * @return Return true if {@param other} compares not equal to this iterator instance.
+		 */
+		bool operator!=(
+			const const_iterator& other ) const
+		{
+			return not this->operator==( other );
+		}
+
+		/**
+		 * Member redirect.
+		 * @return Const pointer to the enumeration.
+		 */
+		pointer operator->() const
+		{
+			return &mEnumeration;
+		}
+
+		/**
+		 * Dereference operator.
+		 * @return Const reference to the enumeration.
+		 */
+		reference operator*() const
+		{
+			return mEnumeration;
+		}
+
+		/**
+		 * Post-increment operator.
+		 * @return iterator to the prior enumeration.
+		 */
+		const_iterator operator++( int )
+		{
+			const_iterator previous( *this );
+			this->operator++();
+			return previous;
+		}
+
+		/**
+		 * Pre-increment operator.
+		 * Steps to the next ordering of the subset in place, and once the
+		 * orderings wrap around to the sorted subset, to the next subset.
+		 * @return Reference to this iterator instance.
+		 */
+		const_iterator& operator++()
+		{
+			if ( mIsEnd or std::next_permutation( mEnumeration.begin(), mEnumeration.end() ) )
+			{
+				return *this;
+			}
+
+			size_t index = mSubsetSize;
+			for ( ; index-- && mEnumeration[ index ] == ( mNumberElements - mSubsetSize + index ); );
+
+			if ( size_t( -1 ) != index )
+			{
+				for ( mEnumeration[ index ]++; ++index < mEnumeration.size();
+					mEnumeration[ index ] = SizeT( mEnumeration[ index - 1 ] + 1 ) );
+			}
+			else
+			{
+				mIsEnd = true;
+			}
+
+			return *this;
+		}
+
+		/**
+		 * Swap this iterator with another.
+		 * @param other Reference to the iterator to swap with.
+		 */
+		void swap(
+			const_iterator& other )
+		{
+			std::swap( mIsEnd, other.mIsEnd );
+			std::swap( mNumberElements, other.mNumberElements );
+			std::swap( mSubsetSize, other.mSubsetSize );
+			std::swap( mEnumeration, other.mEnumeration );
+		}
+	};
+
+	/**
+	 * Default constructor.
+	 * @param numberElements Number of elements to choose from. [default: 0]
+	 * @param subsetSize Numer of element to choose. [default: 0]
+	 * @throw std::invalid_argument if the offsets of {@param numberElements} can't be represented by SizeT.
+	 */
+	CombinationPermutation(
+		size_t numberElements = 0,
+		size_t subsetSize = 0 )
+	{
+		if ( ( 0 < numberElements ) and ( std::numeric_limits< SizeT >::max() < numberElements - 1 ) )
+		{
+			throw std::invalid_argument( "numberElements exceeds the range of SizeT" );
+		}
+
+		mNumberElements = numberElements;
+		mSubsetSize = subsetSize;
+	}
+
+	/**
+	 * Move constructor.
+	 * @param other R-Value to the CombinationPermutation to move.
+	 */
+	CombinationPermutation(
+		CombinationPermutation&& other )
+	{
+		_moveAssign( std::move( other ) );
+	}
+
+	/**
+	 * Copy constructor.
+	 * @param other Const reference to the CombinationPermutation to copy.
+	 */
+	CombinationPermutation(
+		const CombinationPermutation& other )
+	{
+		_copyAssign( other );
+	}
+
+	/**
+	 * The ordering at the given rank of the enumeration.
+	 * @param rank Rank of the ordering, starting from 0.
+	 * @return Vector of offsets of the ordering.
+	 * @throw std::out_of_range if {@param rank} isn't less than size().
+	 * @throw std::overflow_error if the number of orderings doesn't fit in a size_t.
+	 */
+	std::vector< SizeT > at(
+		size_t rank ) const
+	{
+		if ( size() <= rank )
+		{
+			throw std::out_of_range( "rank is outside of the enumeration" );
+		}
+
+		std::vector< SizeT > ordering( mSubsetSize );
+		_unrank( mNumberElements, mSubsetSize, rank, ordering.data() );
+		return ordering;
+	}
+
+	/**
+	 * Beginning iterator.
+	 * @return Iterator to the beginning of the enumeration.
+	 */
+	const_iterator begin() const
+	{
+		return const_iterator( false, mNumberElements, mSubsetSize, 0 );
+	}
+
+	/**
+	 * End iterator.
+	 * @return Iterator to the end of the enumeration.
+	 */
+	const_iterator end() const
+	{
+		return const_iterator( true, mNumberElements, mSubsetSize, 0 );
+	}
+
+	/**
+	 * The number of elements.
+	 * @return The number of elements.
+	 */
+	size_t numberElements() const
+	{
+		return mNumberElements;
+	}
+
+	/**
+	 * Move assignment operator.
+	 * @param other R-Value to the CombinationPermutation object to move to this instance.
+	 * @return Reference to this CombinationPermutation object is returned.
+	 */
+	CombinationPermutation& operator=(
+		CombinationPermutation&& other )
+	{
+		if ( this != &other )
+		{
+			_moveAssign( std::move( other ) );
+		}
+
+		return *this;
+	}
+
+	/**
+	 * Copy assignment operator.
+	 * @param other Const reference to the CombinationPermutation object to copy to this instance.
+	 * @return Reference to this CombinationPermutation object is returned.
+	 */
+	CombinationPermutation& operator=(
+		const CombinationPermutation& other )
+	{
+		if ( this != &other )
+		{
+			_copyAssign( other );
+		}
+
+		return *this;
+	}
+
+	/**
+	 * The rank of an ordering within the enumeration.
+	 * @param ordering Const reference to the K distinct offsets of the ordering.
+	 * @return Rank of {@param ordering}, starting from 0.
+	 * @throw std::invalid_argument if {@param ordering} isn't part of the enumeration.
+	 * @throw std::overflow_error if the number of orderings doesn't fit in a size_t.
+	 */
+	size_t rank(
+		const std::vector< SizeT >& ordering ) const
+	{
+		if ( ( 0 == size() ) or ( ordering.size() != mSubsetSize ) )
+		{
+			throw std::invalid_argument( "ordering isn't part of the enumeration" );
+		}
+
+		std::vector< SizeT > subset( ordering );
+		std::sort( subset.begin(), subset.end() );
+
+		size_t orderings;
+		fallingFactorial( mSubsetSize, mSubsetSize, orderings );
+		size_t rank = BasicCombination< SizeT >( mNumberElements, mSubsetSize ).rank( subset ) * orderings;
+
+		// Encode the Lehmer code, counting the later offsets smaller than each offset.
+		for ( size_t index = 0; index < mSubsetSize; ++index )
+		{
+			orderings /= mSubsetSize - index;
+			rank += orderings * size_t( std::count_if( ordering.begin() + index + 1, ordering.end(),
+				[ & ]( SizeT offset ) { return offset < ordering[ index ]; } ) );
+		}
+
+		return rank;
+	}
+
+	/**
+	 * The number of orderings, N choose K times K!.
+	 * @return The number of orderings in the enumeration.
+	 * @throw std::overflow_error if the number of orderings doesn't fit in a size_t.
+	 */
+	size_t size() const
+	{
+		return _size( mNumberElements, mSubsetSize );
+	}
+
+	/**
+	 * A contiguous sub-range of the enumeration.
+	 * @param firstRank Rank of the first ordering of the slice.
+	 * @param count Number of orderings in the slice.
+	 * @return Slice over the orderings of rank [firstRank, firstRank + count).
+	 * @throw std::out_of_range if the slice extends past the end of the enumeration.
+	 * @throw std::overflow_error if the number of orderings doesn't fit in a size_t.
+	 */
+	Slice< const_iterator > slice(
+		size_t firstRank,
+		size_t count ) const
+	{
+		size_t total = size();
+
+		if ( ( total < firstRank ) or ( total - firstRank < count ) )
+		{
+			throw std::out_of_range( "slice is outside of the enumeration" );
+		}
+
+		return Slice< const_iterator >(
+			const_iterator( total == firstRank, mNumberElements, mSubsetSize, firstRank ),
+			const_iterator( total == firstRank + count, mNumberElements, mSubsetSize, firstRank + count ),
+			firstRank, count );
+	}
+
+	/**
+	 * The number of elements to choose.
+	 * @return The subset size.
+	 */
+	size_t subsetSize() const
+	{
+		return mSubsetSize;
+	}
+};
@@ -0,0 +1,603 @@
+/**
+ * Copyright ©2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+#include <cerrno>
+#include <fcntl.h>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <system_error>
+#include <unistd.h>
+#endif
+
+#include "CombinationFormat.hpp"
+#include "Varint.hpp"
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+/**
+ * Class for a read only memory mapping of a whole file, for handing
+ * a packed enumeration to CombinationReader without reading it in.
+ *
+ * Note:
+ *   - Requires C++14 and above, and a POSIX system.
+ */
+class MappedFile
+{
+private:
+	const uint8_t* mData;
+	size_t mSize;
+
+	void _moveAssign(
+		MappedFile&& other )
+	{
+		mData = std::exchange( other.mData, nullptr );
+		mSize = std::exchange( other.mSize, 0 );
+	}
+
+	void _unmap()
+	{
+		if ( nullptr != mData )
+		{
+			::munmap( const_cast< uint8_t* >( mData ), mSize );
+		}
+
+		mData = nullptr;
+		mSize = 0;
+	}
+
+public:
+	/**
+	 * Default constructor, an empty mapping.
+	 */
+	MappedFile()
+	{
+		mData = nullptr;
+		mSize = 0;
+	}
+
+	/**
+	 * Map the file at {@param path}.
+	 * @param path Const reference to the path of the file.
+	 * @throw std::system_error if the file can't be opened or mapped.
+	 */
+	explicit MappedFile(
+		const std::string& path )
+	{
+		mData = nullptr;
+		mSize = 0;
+
+		int descriptor = ::open( path.c_str(), O_RDONLY );
+		struct stat status;
+
+		if ( ( -1 == descriptor ) or ( -1 == ::fstat( descriptor, &status ) ) )
+		{
+			int error = errno;
+
+			if ( -1 != descriptor )
+			{
+				::close( descriptor );
+			}
+
+			throw std::system_error( error, std::generic_category(), "failed to open " + path );
+		}
+
+		// An empty file can't be mapped, and is left as an empty mapping.
+		if ( 0 < status.st_size )
+		{
+			void* data = ::mmap( nullptr, size_t( status.st_size ), PROT_READ, MAP_PRIVATE, descriptor, 0 );
+
+			if ( MAP_FAILED == data )
+			{
+				int error = errno;
+				::close( descriptor );
+				throw std::system_error( error, std::generic_category(), "failed to map " + path );
+			}
+
+			mData = static_cast< const uint8_t* >( data );
+			mSize = size_t( status.st_size );
+		}
+
+		::close( descriptor );
+	}
+
+	/**
+	 * Move constructor.
+	 * @param other R-Value to the mapping to move.
+	 */
+	MappedFile(
+		MappedFile&& other )
+	{
+		_moveAssign( std::move( other ) );
+	}
+
+	MappedFile( const MappedFile& ) = delete;
+	MappedFile& operator=( const MappedFile& ) = delete;
+
+	/**
+	 * Destructor, unmapping the file.
+	 */
+	~MappedFile()
+	{
+		_unmap();
+	}
+
+	/**
+	 * The mapped bytes.
+	 * @return Const pointer to the start of the file.
+	 */
+	const uint8_t* data() const
+	{
+		return mData;
+	}
+
+	/**
+	 * Move assignment operator.
+	 * @param other R-Value to the mapping to move to this instance.
+	 * @return Reference to this mapping.
+	 */
+	MappedFile& operator=(
+		MappedFile&& other )
+	{
+		if ( this != &other )
+		{
+			_unmap();
+			_moveAssign( std::move( other ) );
+		}
+
+		return *this;
+	}
+
+	/**
+	 * The size of the file.
+	 * @return The number of mapped bytes.
+	 */
+	size_t size() const
+	{
+		return mSize;
+	}
+};
+#endif
+
+/**
+ * Class for replaying a packed enumeration written by CombinationWriter
+ * from memory, such as a MappedFile. The reader doesn't own the bytes,
+ * which have to outlive it and its iterators.
+ *
+ * As an example of use:
+ *     MappedFile file( "subsets.cmb" );
+ *     CombinationReader reader( file.data(), file.size() );
+ *     for ( auto iterator = reader.seek( 1000000 ); iterator != reader.end(); ++iterator ) {
+ *         process( *iterator ); }
+ *
+ * Seeking to a subset by index is O(1) in the number of subsets for every
+ * format: the fixed width formats compute the record's position, while
+ * the Delta format decodes forward from the nearest keyframe, found in
+ * an index of the keyframes built when the reader is constructed.
+ *
+ * Note:
+ *   - Requires C++14 and above.
+ */
+class CombinationReader
+{
+private:
+	const uint8_t* mData;
+	CombinationFileHeader mHeader;
+	std::vector< size_t > mKeyframes;
+	size_t mLength;
+	size_t mSize;
+
+	// Decode the Delta record at {position} over the previous subset held in
+	// {subset}, returning the position of the next record.
+	template < typename SizeT >
+	size_t _decodeDelta(
+		size_t position,
+		SizeT* subset,
+		bool isKeyframe ) const
+	{
+		const uint8_t* data = mData + position;
+		const uint8_t* last = mData + mLength;
+		size_t subsetSize = size_t( mHeader.subsetSize() );
+		uint64_t prefix = readVarint( data, last );
+
+		if ( ( subsetSize < prefix ) or ( isKeyframe and ( 0 != prefix ) ) )
+		{
+			throw std::invalid_argument( "delta record has an invalid prefix" );
+		}
+
+		for ( size_t index = size_t( prefix ); index < subsetSize; ++index )
+		{
+			uint64_t floor = index ? uint64_t( subset[ index - 1 ] ) + 1 : 0;
+			uint64_t gap = readVarint( data, last );
+
+			if ( mHeader.numberElements() - floor <= gap )
+			{
+				throw std::invalid_argument( "delta record isn't a subset of the enumeration" );
+			}
+
+			subset[ index ] = SizeT( floor + gap );
+		}
+
+		return size_t( data - mData );
+	}
+
+	template < typename SizeT >
+	void _decodeFixed(
+		size_t index,
+		SizeT* subset ) const
+	{
+		const uint8_t* record = mData + CombinationFileHeader::Size + index * mHeader.recordSize();
+		size_t subsetSize = size_t( mHeader.subsetSize() );
+
+		if ( CombinationFormat::Indices == mHeader.format() )
+		{
+			size_t width = mHeader.indexWidth();
+			uint64_t floor = 0;
+
+			for ( size_t offset = 0; offset < subsetSize; ++offset, record += width )
+			{
+				uint64_t value = 0;
+
+				for ( size_t byte = width; byte--; )
+				{
+					value = ( value << 8 ) | record[ byte ];
+				}
+
+				if ( ( value < floor ) or ( mHeader.numberElements() <= value ) )
+				{
+					throw std::invalid_argument( "indices record isn't a subset of the enumeration" );
+				}
+
+				subset[ offset ] = SizeT( value );
+				floor = value + 1;
+			}
+
+			return;
+		}
+
+		size_t count = 0;
+
+		for ( size_t byte = 0; byte < mHeader.recordSize(); ++byte )
+		{
+			for ( unsigned bits = record[ byte ]; 0 != bits; bits &= bits - 1 )
+			{
+				unsigned bit = 0;
+				for ( ; 0 == ( bits & ( 1u << bit ) ); ++bit );
+
+				if ( ( subsetSize == count ) or ( mHeader.numberElements() <= byte * 8 + bit ) )
+				{
+					throw std::invalid_argument( "bitmask record isn't a subset of the enumeration" );
+				}
+
+				subset[ count++ ] = SizeT( byte * 8 + bit );
+			}
+		}
+
+		if ( subsetSize != count )
+		{
+			throw std::invalid_argument( "bitmask record isn't a subset of the enumeration" );
+		}
+	}
+
+public:
+	/**
+	 * Iterator class for replaying the subsets in order.
+	 * The Delta format is decoded record by record, rather than seeking.
+	 */
+	class const_iterator
+	{
+	private:
+		friend class CombinationReader;
+
+		size_t mIndex;
+		bool mIsEnd;
+		size_t mPosition;
+		const CombinationReader* mReader;
+		std::vector< size_t > mSubset;
+
+		const_iterator(
+			const CombinationReader* reader,
+			size_t index )
+		{
+			mIndex = index;
+			mIsEnd = ( reader->size() <= index );
+			mPosition = 0;
+			mReader = reader;
+
+			if ( not mIsEnd )
+			{
+				mSubset.resize( size_t( reader->mHeader.subsetSize() ) );
+				_load();
+			}
+		}
+
+		void _load()
+		{
+			if ( CombinationFormat::Delta != mReader->mHeader.format() )
+			{
+				mReader->_decodeFixed( mIndex, mSubset.data() );
+				return;
+			}
+
+			size_t interval = CombinationFileHeader::DeltaKeyframeInterval;
+			size_t keyframe = mIndex / interval;
+			mPosition = mReader->mKeyframes[ keyframe ];
+
+			for ( size_t index = keyframe * interval; index <= mIndex; ++index )
+			{
+				mPosition = mReader->_decodeDelta( mPosition, mSubset.data(), index == keyframe * interval );
+			}
+		}
+
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using difference_type   = std::ptrdiff_t;
+		using value_type        = std::vector< size_t >;
+		using pointer           = const std::vector< size_t >*;
+		using reference         = const std::vector< size_t >&;
+
+		/**
+		 * Default constructor.
+		 */
+		const_iterator()
+		{
+			mIndex = 0;
+			mIsEnd = true;
+			mPosition = 0;
+			mReader = nullptr;
+		}
+
+		/**
+		 * Equality operator.
+		 * @param other Const reference to the iterator to compare against.
+		 * @return Return true if {@param other} compares equal to this iterator instance.
+		 */
+		bool operator==(
+			const const_iterator& other ) const
+		{
+			if ( mIsEnd or other.mIsEnd )
+			{
+				return mIsEnd == other.mIsEnd;
+			}
+
+			return ( mReader == other.mReader ) and ( mIndex == other.mIndex );
+		}
+
+		/**
+		 * Inequality operator.
+		 * @param other Const reference to the iterator to compare against.
+		 * @return Return true if {@param other} compares not equal to this iterator instance.
+		 */
+		bool operator!=(
+			const const_iterator& other ) const
+		{
+			return not this->operator==( other );
+		}
+
+		/**
+		 * Member redirect.
+		 * @return Const pointer to the subset.
+		 */
+		pointer operator->() const
+		{
+			return &mSubset;
+		}
+
+		/**
+		 * Dereference operator.
+		 * @return Const reference to the subset.
+		 */
+		reference operator*() const
+		{
+			return mSubset;
+		}
+
+		/**
+		 * Post-increment operator.
+		 * @return iterator to the prior subset.
+		 */
+		const_iterator operator++( int )
+		{
+			const_iterator previous( *this );
+			this->operator++();
+			return previous;
+		}
+
+		/**
+		 * Pre-increment operator.
+		 * @return Reference to this iterator instance.
+		 */
+		const_iterator& operator++()
+		{
+			if ( mIsEnd )
+			{
+				return *this;
+			}
+
+			if ( mReader->size() <= ++mIndex )
+			{
+				mIsEnd = true;
+			}
+			else if ( CombinationFormat::Delta == mReader->mHeader.format() )
+			{
+				mPosition = mReader->_decodeDelta( mPosition, mSubset.data(),
+					0 == mIndex % CombinationFileHeader::DeltaKeyframeInterval );
+			}
+			else
+			{
+				mReader->_decodeFixed( mIndex, mSubset.data() );
+			}
+
+			return *this;
+		}
+	};
+
+	/**
+	 * Constructor, reading the header and, for the Delta format, validating
+	 * the records and indexing the keyframes in one pass.
+	 * @param data Const pointer to a packed enumeration, which must outlive the reader.
+	 * @param length Number of bytes at {@param data}.
+	 * @throw std::invalid_argument if the bytes aren't a packed enumeration.
+	 */
+	CombinationReader(
+		const uint8_t* data,
+		size_t length ) :
+		mHeader( CombinationFileHeader::decode( data, length ) )
+	{
+		mData = data;
+		mLength = length;
+		mSize = 0;
+
+		if ( CombinationFormat::Delta != mHeader.format() )
+		{
+			size_t recordSize = mHeader.recordSize();
+			size_t records = length - CombinationFileHeader::Size;
+
+			if ( ( 0 == recordSize ) ? ( 0 != records ) : ( 0 != records % recordSize ) )
+			{
+				throw std::invalid_argument( "combination data ends with a partial record" );
+			}
+
+			mSize = recordSize ? records / recordSize : 0;
+			return;
+		}
+
+		// The header has checked that a first record of K offsets fits in the data.
+		std::vector< uint64_t > subset( ( CombinationFileHeader::Size < length ) ? size_t( mHeader.subsetSize() ) : 0 );
+
+		for ( size_t position = CombinationFileHeader::Size; position < length; ++mSize )
+		{
+			bool isKeyframe = ( 0 == mSize % CombinationFileHeader::DeltaKeyframeInterval );
+
+			if ( isKeyframe )
+			{
+				mKeyframes.push_back( position );
+			}
+
+			position = _decodeDelta( position, subset.data(), isKeyframe );
+		}
+	}
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+	/**
+	 * Constructor over a mapped file.
+	 * @param file Const reference to the mapping, which must outlive the reader.
+	 * @throw std::invalid_argument if the file isn't a packed enumeration.
+	 */
+	explicit CombinationReader(
+		const MappedFile& file ) :
+		CombinationReader( file.data(), file.size() )
+	{
+	}
+#endif
+
+	/**
+	 * The subset at the given index.
+	 * @param index Index of the subset within the data, starting from 0.
+	 * @return Vector of offsets of the subset.
+	 * @throw std::out_of_range if {@param index} isn't less than size().
+	 */
+	std::vector< size_t > at(
+		size_t index ) const
+	{
+		if ( mSize <= index )
+		{
+			throw std::out_of_range( "index is outside of the combination data" );
+		}
+
+		return *const_iterator( this, index );
+	}
+
+	/**
+	 * Beginning iterator.
+	 * @return Iterator to the first subset.
+	 */
+	const_iterator begin() const
+	{
+		return const_iterator( this, 0 );
+	}
+
+	/**
+	 * End iterator.
+	 * @return Iterator past the last subset.
+	 */
+	const_iterator end() const
+	{
+		return const_iterator();
+	}
+
+	/**
+	 * The rank of the first subset within the enumeration of ( N, K ),
+	 * so that subset i has rank firstRank() + i.
+	 * @return The rank of the first subset.
+	 */
+	uint64_t firstRank() const
+	{
+		return mHeader.firstRank();
+	}
+
+	/**
+	 * The record layout.
+	 * @return The format.
+	 */
+	CombinationFormat format() const
+	{
+		return mHeader.format();
+	}
+
+	/**
+	 * The number of elements.
+	 * @return The number of elements.
+	 */
+	size_t numberElements() const
+	{
+		return size_t( mHeader.numberElements() );
+	}
+
+	/**
+	 * The number of subsets held.
+	 * @return The number of subsets.
+	 */
+	size_t size() const
+	{
+		return mSize;
+	}
+
+	/**
+	 * Iterator to the subset at the given index, found without replaying
+	 * the subsets before it.
+	 * @param index Index of the subset, at most size().
+	 * @return Iterator to the subset, or the end iterator for size().
+	 * @throw std::out_of_range if {@param index} is greater than size().
+	 */
+	const_iterator seek(
+		size_t index ) const
+	{
+		if ( mSize < index )
+		{
+			throw std::out_of_range( "index is outside of the combination data" );
+		}
+
+		return const_iterator( this, index );
+	}
+
+	/**
+	 * The number of elements to choose.
+	 * @return The subset size.
+	 */
+	size_t subsetSize() const
+	{
+		return size_t( mHeader.subsetSize() );
+	}
+};
@@ -0,0 +1,292 @@
+/**
+ * Copyright ©2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "Combination.hpp"
+
+/**
+ * Class for drawing uniformly random subsets of K of N elements, for
+ * spaces too large to enumerate. Each subset is drawn with Floyd's
+ * algorithm in O(K) draws, and is returned as the strictly increasing
+ * offsets that Combination's iterator refers to.
+ *
+ * As an example of use:
+ *     CombinationSampler sampler( 200, 12, seed );
+ *     for ( size_t trial = 0; trial < trials; ++trial ) {
+ *         estimate += evaluate( sampler.next() ); }
+ *
+ * A sampler holds its own engine, so each thread should hold its own
+ * sampler. forStream() gives samplers sharing a seed but drawing from
+ * independent streams, so a parallel run is reproducible from one seed:
+ *     for ( size_t thread = 0; thread < threads; ++thread ) {
+ *         workers.emplace_back( [ thread, local = sampler.forStream( thread ) ]() mutable {
+ *             process( local.next() ); } ); }
+ *
+ * Note:
+ *   - Requires C++14 and above.
+ */
+template < typename SizeT = size_t, typename Engine = std::mt19937_64 >
+class BasicCombinationSampler
+{
+	static_assert( std::is_integral< SizeT >::value and std::is_unsigned< SizeT >::value,
+		"SizeT must be an unsigned integral type" );
+
+private:
+	Engine mEngine;
+	size_t mNumberElements;
+	std::vector< SizeT > mScratch;
+	uint64_t mSeed;
+	uint64_t mStream;
+	std::vector< SizeT > mSubset;
+	size_t mSubsetSize;
+
+	void _reseed()
+	{
+		std::seed_seq sequence { uint32_t( mSeed ), uint32_t( mSeed >> 32 ),
+			uint32_t( mStream ), uint32_t( mStream >> 32 ) };
+		mEngine.seed( sequence );
+	}
+
+	size_t _uniform(
+		size_t last )
+	{
+		return std::uniform_int_distribution< size_t >( 0, last )( mEngine );
+	}
+
+	// Floyd's algorithm, drawing {count} distinct offsets of {numberElements}
+	// into {out} in increasing order. Each draw either adds a new offset or,
+	// on a repeat, the largest offset considered so far, which goes last.
+	void _floyd(
+		size_t numberElements,
+		size_t count,
+		SizeT* out )
+	{
+		size_t drawn = 0;
+
+		for ( size_t last = numberElements - count; last < numberElements; ++last, ++drawn )
+		{
+			SizeT offset = SizeT( _uniform( last ) );
+			SizeT* position = std::lower_bound( out, out + drawn, offset );
+
+			if ( ( position != out + drawn ) and ( *position == offset ) )
+			{
+				out[ drawn ] = SizeT( last );
+			}
+			else
+			{
+				std::copy_backward( position, out + drawn, out + drawn + 1 );
+				*position = offset;
+			}
+		}
+	}
+
+public:
+	/**
+	 * Default constructor.
+	 * @param numberElements Number of elements to choose from. [default: 0]
+	 * @param subsetSize Number of elements to choose. [default: 0]
+	 * @param seed Seed of the engine. [default: 0]
+	 * @param stream Stream of the engine, for independent samplers sharing a seed. [default: 0]
+	 * @throw std::invalid_argument if the offsets of {@param numberElements} can't be represented by SizeT.
+	 */
+	BasicCombinationSampler(
+		size_t numberElements = 0,
+		size_t subsetSize = 0,
+		uint64_t seed = 0,
+		uint64_t stream = 0 )
+	{
+		if ( ( 0 < numberElements ) and ( std::numeric_limits< SizeT >::max() < numberElements - 1 ) )
+		{
+			throw std::invalid_argument( "numberElements exceeds the range of SizeT" );
+		}
+
+		mNumberElements = numberElements;
+		mSeed = seed;
+		mStream = stream;
+		mSubsetSize = subsetSize;
+		_reseed();
+	}
+
+	/**
+	 * A sampler drawing from another stream of the same seed, such as one per thread.
+	 * @param stream Stream of the engine.
+	 * @return Sampler of the same N and K, seeded with seed() and {@param stream}.
+	 */
+	BasicCombinationSampler forStream(
+		uint64_t stream ) const
+	{
+		return BasicCombinationSampler( mNumberElements, mSubsetSize, mSeed, stream );
+	}
+
+	/**
+	 * Draw a subset into the sampler's buffer, which is reused by the next draw.
+	 * @return Const reference to the strictly increasing offsets of the subset.
+	 * @throw std::out_of_range if there are no subsets to draw, K = 0 or K > N.
+	 */
+	const std::vector< SizeT >& next()
+	{
+		mSubset.resize( mSubsetSize );
+		next( mSubset.data() );
+		return mSubset;
+	}
+
+	/**
+	 * Draw a subset into a caller provided buffer. For K over N / 2, the
+	 * N - K elements left out are drawn instead, then their complement taken.
+	 * @param out Pointer to a buffer of at least K offsets.
+	 * @throw std::out_of_range if there are no subsets to draw, K = 0 or K > N.
+	 */
+	void next(
+		SizeT* out )
+	{
+		if ( ( 0 == mSubsetSize ) or ( mNumberElements < mSubsetSize ) )
+		{
+			throw std::out_of_range( "there are no subsets to sample" );
+		}
+
+		if ( mSubsetSize <= mNumberElements - mSubsetSize )
+		{
+			_floyd( mNumberElements, mSubsetSize, out );
+			return;
+		}
+
+		size_t excluded = mNumberElements - mSubsetSize;
+		mScratch.resize( excluded );
+		_floyd( mNumberElements, excluded, mScratch.data() );
+
+		auto skip = mScratch.begin();
+		for ( size_t element = 0; element < mNumberElements; ++element )
+		{
+			if ( ( skip != mScratch.end() ) and ( *skip == element ) )
+			{
+				++skip;
+			}
+			else
+			{
+				*out++ = SizeT( element );
+			}
+		}
+	}
+
+	/**
+	 * The number of elements.
+	 * @return The number of elements.
+	 */
+	size_t numberElements() const
+	{
+		return mNumberElements;
+	}
+
+	/**
+	 * Draw distinct subsets without replacement, into a caller provided buffer
+	 * in the layout of Combination::const_iterator::nextBatch, K offsets per
+	 * subset. Their ranks are drawn with Floyd's algorithm over [0, N choose K),
+	 * then the subsets are written in lexicographic order, stepping an iterator
+	 * between consecutive ranks.
+	 * @param out Pointer to a buffer of at least {@param count} * K offsets.
+	 * @param count Number of subsets to draw.
+	 * @return The number of subsets written, {@param count}.
+	 * @throw std::invalid_argument if {@param count} is greater than N choose K.
+	 * @throw std::overflow_error if N choose K doesn't fit in a size_t.
+	 */
+	size_t sampleDistinct(
+		SizeT* out,
+		size_t count )
+	{
+		BasicCombination< SizeT > combination( mNumberElements, mSubsetSize );
+		size_t total = combination.size();
+
+		if ( total < count )
+		{
+			throw std::invalid_argument( "count exceeds the number of subsets" );
+		}
+
+		if ( 0 == count )
+		{
+			return count;
+		}
+
+		std::unordered_set< size_t > drawn;
+		drawn.reserve( count );
+
+		for ( size_t last = total - count; last < total; ++last )
+		{
+			if ( not drawn.insert( _uniform( last ) ).second )
+			{
+				drawn.insert( last );
+			}
+		}
+
+		std::vector< size_t > ranks( drawn.begin(), drawn.end() );
+		std::sort( ranks.begin(), ranks.end() );
+
+		using difference_type = typename BasicCombination< SizeT >::const_iterator::difference_type;
+		auto iterator = BasicCombination< SizeT >::const_iterator::resume(
+			CombinationCheckpoint( mNumberElements, mSubsetSize, ranks.front() ) );
+
+		for ( size_t index = 0; index < count; ++index, out += mSubsetSize )
+		{
+			size_t step = index ? ranks[ index ] - ranks[ index - 1 ] : 0;
+
+			if ( size_t( std::numeric_limits< difference_type >::max() ) < step )
+			{
+				iterator = BasicCombination< SizeT >::const_iterator::resume(
+					CombinationCheckpoint( mNumberElements, mSubsetSize, ranks[ index ] ) );
+			}
+			else if ( 0 < step )
+			{
+				iterator += difference_type( step );
+			}
+
+			std::copy( iterator->begin(), iterator->end(), out );
+		}
+
+		return count;
+	}
+
+	/**
+	 * The seed of the engine.
+	 * @return The seed.
+	 */
+	uint64_t seed() const
+	{
+		return mSeed;
+	}
+
+	/**
+	 * The stream of the engine.
+	 * @return The stream.
+	 */
+	uint64_t stream() const
+	{
+		return mStream;
+	}
+
+	/**
+	 * The number of elements to choose.
+	 * @return The subset size.
+	 */
+	size_t subsetSize() const
+	{
+		return mSubsetSize;
+	}
+};
+
+/**
+ * Sampler of size_t offsets.
+ */
+using CombinationSampler = BasicCombinationSampler<>;
@@ -0,0 +1,99 @@
+/**
+ * Copyright ©2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#pragma once
+
+#include <cstdint>
+
+/**
+ * Counters of the work done by Combination iterators on one thread, for
+ * telling the cost of the enumeration apart from the cost of the callback.
+ *
+ * The counters are only updated when COMBINATION_ENABLE_STATISTICS is
+ * defined before Combination.hpp is included, as each update is a
+ * thread local increment on the hot path. Otherwise they stay at zero,
+ * and querying them still compiles. Define it for the whole program, as
+ * the COMBINATION_ENABLE_STATISTICS option of the CMake build does, so
+ * that every translation unit sees the same iterator.
+ *
+ * As an example of use:
+ *     threadCombinationStatistics() = CombinationStatistics();
+ *     for ( const auto& subset : Combination( 40, 6 ) ) {
+ *         process( subset ); }
+ *     const auto& statistics = threadCombinationStatistics();
+ *     std::cout << double( statistics.carries ) / statistics.increments << std::endl;
+ *
+ * Note:
+ *   - Requires C++14 and above.
+ */
+struct CombinationStatistics
+{
+	// Enumeration buffers allocated by iterators.
+	uint64_t allocations = 0;
+
+	// Positions the backward scan of an increment walked past before finding
+	// the offset to bump, summed over all increments.
+	uint64_t carries = 0;
+
+	// Iterators copied.
+	uint64_t copies = 0;
+
+	// Steps to the next subset, whether by an increment or by skipPrefix.
+	uint64_t increments = 0;
+
+	// Jumps to a rank by unranking, from random access, slicing and resuming.
+	uint64_t seeks = 0;
+
+	/**
+	 * Addition assignment operator, for totalling the counters of several threads.
+	 * @param other Const reference to the counters to add.
+	 * @return Reference to these counters.
+	 */
+	CombinationStatistics& operator+=(
+		const CombinationStatistics& other )
+	{
+		allocations += other.allocations;
+		carries += other.carries;
+		copies += other.copies;
+		increments += other.increments;
+		seeks += other.seeks;
+		return *this;
+	}
+
+	/**
+	 * Subtraction operator, for the counters accumulated since a snapshot.
+	 * @param other Const reference to the earlier snapshot.
+	 * @return The difference of each counter.
+	 */
+	CombinationStatistics operator-(
+		const CombinationStatistics& other ) const
+	{
+		CombinationStatistics difference;
+		difference.allocations = allocations - other.allocations;
+		difference.carries = carries - other.carries;
+		difference.copies = copies - other.copies;
+		difference.increments = increments - other.increments;
+		difference.seeks = seeks - other.seeks;
+		return difference;
+	}
+};
+
+/**
+ * The counters of the calling thread, which may be reset by assigning
+ * a default constructed CombinationStatistics to them.
+ * @return Reference to the counters of the calling thread.
+ */
+inline CombinationStatistics& threadCombinationStatistics()
+{
+	static thread_local CombinationStatistics statistics;
+	return statistics;
+}
+
+#if defined( COMBINATION_ENABLE_STATISTICS )
+#define COMBINATION_STATISTIC( counter, amount ) \
+	( threadCombinationStatistics().counter += uint64_t( amount ) )
+#else
+#define COMBINATION_STATISTIC( counter, amount ) ( ( void ) 0 )
+#endif
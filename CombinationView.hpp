@@ -0,0 +1,612 @@
+/**
+ * Copyright ©2021-2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Combination.hpp"
+
+/**
+ * Class presenting the subsets of a Combination over a container as the
+ * container's own elements rather than as offsets. Each subset is a Subset,
+ * a pair of pointers to the container and to the iterator's offsets, whose
+ * elements are references into the container, so nothing is copied.
+ *
+ * As an example of use:
+ *     std::vector< std::string > names { "ann", "bob", "cat", "dan" };
+ *     for ( const auto& subset : combinationsOf( names, 2 ) ) {
+ *         std::cout << subset[ 0 ] << " and " << subset[ 1 ] << std::endl; }
+ *
+ * The view holds a pointer to the container, which must outlive the view
+ * and its iterators. Any container with operator[] may be used, and the
+ * subsets are enumerated in the same order as Combination.
+ *
+ * Note:
+ *   - Requires C++14 and above.
+ */
+template < typename Container, typename SizeT = size_t >
+class CombinationView
+{
+public:
+	using element_reference = decltype( std::declval< Container& >()[ 0 ] );
+
+	/**
+	 * Class for a single subset, projected onto the elements of the container.
+	 */
+	class Subset
+	{
+	private:
+		Container* mContainer;
+		const std::vector< SizeT >* mOffsets;
+
+	public:
+		/**
+		 * Iterator over the elements of a subset, in the order of their offsets.
+		 */
+		class const_iterator
+		{
+		private:
+			Container* mContainer;
+			const SizeT* mOffset;
+
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using difference_type   = std::ptrdiff_t;
+			using value_type        = typename std::decay< element_reference >::type;
+			using pointer           = typename std::remove_reference< element_reference >::type*;
+			using reference         = element_reference;
+
+			/**
+			 * Default constructor.
+			 */
+			const_iterator()
+			{
+				mContainer = nullptr;
+				mOffset = nullptr;
+			}
+
+			/**
+			 * Parameter constructor.
+			 * @param container Pointer to the container of the elements.
+			 * @param offset Pointer to the offset of the element.
+			 */
+			const_iterator(
+				Container* container,
+				const SizeT* offset )
+			{
+				mContainer = container;
+				mOffset = offset;
+			}
+
+			/**
+			 * Equality operator.
+			 * @param other Const reference to the iterator to compare against.
+			 * @return Return true if {@param other} points at the same offset.
+			 */
+			bool operator==(
+				const const_iterator& other ) const
+			{
+				return mOffset == other.mOffset;
+			}
+
+			/**
+			 * Inequality operator.
+			 * @param other Const reference to the iterator to compare against.
+			 * @return Return true if {@param other} points at a different offset.
+			 */
+			bool operator!=(
+				const const_iterator& other ) const
+			{
+				return mOffset != other.mOffset;
+			}
+
+			/**
+			 * Dereference operator.
+			 * @return Reference to the element in the container.
+			 */
+			reference operator*() const
+			{
+				return ( *mContainer )[ *mOffset ];
+			}
+
+			/**
+			 * Member redirect.
+			 * @return Pointer to the element in the container.
+			 */
+			pointer operator->() const
+			{
+				return &( *mContainer )[ *mOffset ];
+			}
+
+			/**
+			 * Post-increment operator.
+			 * @return iterator to the prior element.
+			 */
+			const_iterator operator++( int )
+			{
+				const_iterator previous( *this );
+				++mOffset;
+				return previous;
+			}
+
+			/**
+			 * Pre-increment operator.
+			 * @return Reference to this iterator instance.
+			 */
+			const_iterator& operator++()
+			{
+				++mOffset;
+				return *this;
+			}
+		};
+
+		/**
+		 * Parameter constructor.
+		 * @param container Pointer to the container of the elements.
+		 * @param offsets Pointer to the offsets of the subset.
+		 */
+		Subset(
+			Container* container,
+			const std::vector< SizeT >* offsets )
+		{
+			mContainer = container;
+			mOffsets = offsets;
+		}
+
+		/**
+		 * Beginning iterator.
+		 * @return Iterator to the first element of the subset.
+		 */
+		const_iterator begin() const
+		{
+			return const_iterator( mContainer, mOffsets->data() );
+		}
+
+		/**
+		 * End iterator.
+		 * @return Iterator to one past the last element of the subset.
+		 */
+		const_iterator end() const
+		{
+			return const_iterator( mContainer, mOffsets->data() + mOffsets->size() );
+		}
+
+		/**
+		 * The offsets of the subset into the container.
+		 * @return Const reference to the offsets.
+		 */
+		const std::vector< SizeT >& offsets() const
+		{
+			return *mOffsets;
+		}
+
+		/**
+		 * Element access.
+		 * @param index Position within the subset.
+		 * @return Reference to the element of the container at the offset in position {@param index}.
+		 */
+		element_reference operator[](
+			size_t index ) const
+		{
+			return ( *mContainer )[ ( *mOffsets )[ index ] ];
+		}
+
+		/**
+		 * The number of elements in the subset.
+		 * @return The subset size.
+		 */
+		size_t size() const
+		{
+			return mOffsets->size();
+		}
+	};
+
+	/**
+	 * Iterator class for enumerating over the subsets of the
+	 * container, dereferencing to a Subset of its elements.
+	 */
+	class const_iterator
+	{
+	private:
+		Container* mContainer;
+		typename BasicCombination< SizeT >::const_iterator mIterator;
+
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using difference_type   = std::ptrdiff_t;
+		using value_type        = Subset;
+		using pointer           = void;
+		using reference         = Subset;
+
+		/**
+		 * Default constructor.
+		 */
+		const_iterator()
+		{
+			mContainer = nullptr;
+		}
+
+		/**
+		 * Parameter constructor.
+		 * @param container Pointer to the container of the elements.
+		 * @param iterator The iterator over the offsets of the subsets.
+		 */
+		const_iterator(
+			Container* container,
+			typename BasicCombination< SizeT >::const_iterator iterator ) :
+			mIterator( std::move( iterator ) )
+		{
+			mContainer = container;
+		}
+
+		/**
+		 * Equality operator.
+		 * @param other Const reference to the iterator to compare against.
+		 * @return Return true if {@param other} compares equal to this iterator instance.
+		 */
+		bool operator==(
+			const const_iterator& other ) const
+		{
+			return mIterator == other.mIterator;
+		}
+
+		/**
+		 * Inequality operator.
+		 * @param other Const reference to the iterator to compare against.
+		 * @return Return true if {@param other} compares not equal to this iterator instance.
+		 */
+		bool operator!=(
+			const const_iterator& other ) const
+		{
+			return mIterator != other.mIterator;
+		}
+
+		/**
+		 * Dereference operator.
+		 * @return Subset of the container, valid until this iterator is advanced.
+		 */
+		reference operator*() const
+		{
+			return Subset( mContainer, &*mIterator );
+		}
+
+		/**
+		 * Post-increment operator.
+		 * @return iterator to the prior enumeration.
+		 */
+		const_iterator operator++( int )
+		{
+			const_iterator previous( *this );
+			++mIterator;
+			return previous;
+		}
+
+		/**
+		 * Pre-increment operator.
+		 * @return Reference to this iterator instance.
+		 */
+		const_iterator& operator++()
+		{
+			++mIterator;
+			return *this;
+		}
+
+		/**
+		 * The iterator over the offsets this iterator projects.
+		 * @return Const reference to the underlying iterator.
+		 */
+		const typename BasicCombination< SizeT >::const_iterator& offsets() const
+		{
+			return mIterator;
+		}
+	};
+
+private:
+	Container* mContainer;
+	BasicCombination< SizeT > mCombination;
+
+public:
+	/**
+	 * Parameter constructor.
+	 * @param container Reference to the container to choose the elements of.
+	 * @param subsetSize Numer of element to choose.
+	 */
+	CombinationView(
+		Container& container,
+		size_t subsetSize ) :
+		mCombination( container.size(), subsetSize )
+	{
+		mContainer = &container;
+	}
+
+	/**
+	 * Beginning iterator.
+	 * @return Iterator to the beginning of the enumeration.
+	 */
+	const_iterator begin() const
+	{
+		return const_iterator( mContainer, mCombination.begin() );
+	}
+
+	/**
+	 * End iterator.
+	 * @return Iterator to the end of the enumeration.
+	 */
+	const_iterator end() const
+	{
+		return const_iterator( mContainer, mCombination.end() );
+	}
+
+	/**
+	 * The combination of offsets being projected.
+	 * @return Const reference to the combination.
+	 */
+	const BasicCombination< SizeT >& combination() const
+	{
+		return mCombination;
+	}
+
+	/**
+	 * The number of subsets.
+	 * @return N choose K.
+	 * @throw std::overflow_error if the number of subsets doesn't fit in a size_t.
+	 */
+	size_t size() const
+	{
+		return mCombination.size();
+	}
+};
+
+/**
+ * Class presenting the subsets of a Combination over a contiguous container
+ * of trivially copyable elements as a dense copy of the selected elements.
+ * The iterator owns a K element scratch buffer, and each step only recopies
+ * the elements from the iterator's changedFrom() onward, which for most
+ * steps is the last element alone. Downstream code then reads contiguous
+ * memory rather than gathering through the offsets.
+ *
+ * As an example of use:
+ *     std::vector< double > weights( 40 );
+ *     for ( const auto& selected : materializedCombinationsOf( weights, 5 ) ) {
+ *         total = std::max( total, std::accumulate( selected.begin(), selected.end(), 0.0 ) ); }
+ *
+ * The view holds a pointer to the container's data, which must outlive the
+ * view and its iterators, and must not be reallocated while in use.
+ *
+ * Note:
+ *   - Requires C++14 and above.
+ */
+template < typename T, typename SizeT = size_t >
+class MaterializedCombinationView
+{
+	static_assert( std::is_trivially_copyable< T >::value, "T must be trivially copyable" );
+
+public:
+	/**
+	 * Iterator class for enumerating over the subsets of
+	 * the container, dereferencing to a copy of its elements.
+	 */
+	class const_iterator
+	{
+	private:
+		const T* mData;
+		typename BasicCombination< SizeT >::const_iterator mIterator;
+		typename BasicCombination< SizeT >::const_iterator mEnd;
+		std::vector< T > mScratch;
+
+		void _gather(
+			size_t from )
+		{
+			if ( mIterator != mEnd )
+			{
+				const std::vector< SizeT >& offsets = *mIterator;
+				mScratch.resize( offsets.size() );
+
+				for ( size_t index = from; index < offsets.size(); ++index )
+				{
+					mScratch[ index ] = mData[ offsets[ index ] ];
+				}
+			}
+		}
+
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using difference_type   = std::ptrdiff_t;
+		using value_type        = const std::vector< T >;
+		using pointer           = const std::vector< T >*;
+		using reference         = const std::vector< T >&;
+
+		/**
+		 * Default constructor.
+		 */
+		const_iterator()
+		{
+			mData = nullptr;
+		}
+
+		/**
+		 * Parameter constructor.
+		 * @param data Pointer to the contiguous elements of the container.
+		 * @param iterator The iterator over the offsets of the subsets.
+		 * @param end The end iterator of the offsets.
+		 */
+		const_iterator(
+			const T* data,
+			typename BasicCombination< SizeT >::const_iterator iterator,
+			typename BasicCombination< SizeT >::const_iterator end ) :
+			mIterator( std::move( iterator ) ),
+			mEnd( std::move( end ) )
+		{
+			mData = data;
+			_gather( 0 );
+		}
+
+		/**
+		 * Equality operator.
+		 * @param other Const reference to the iterator to compare against.
+		 * @return Return true if {@param other} compares equal to this iterator instance.
+		 */
+		bool operator==(
+			const const_iterator& other ) const
+		{
+			return mIterator == other.mIterator;
+		}
+
+		/**
+		 * Inequality operator.
+		 * @param other Const reference to the iterator to compare against.
+		 * @return Return true if {@param other} compares not equal to this iterator instance.
+		 */
+		bool operator!=(
+			const const_iterator& other ) const
+		{
+			return mIterator != other.mIterator;
+		}
+
+		/**
+		 * Member redirect.
+		 * @return Const pointer to the selected elements.
+		 */
+		pointer operator->() const
+		{
+			return &mScratch;
+		}
+
+		/**
+		 * Dereference operator.
+		 * @return Const reference to the selected elements.
+		 */
+		reference operator*() const
+		{
+			return mScratch;
+		}
+
+		/**
+		 * Post-increment operator.
+		 * @return iterator to the prior enumeration.
+		 */
+		const_iterator operator++( int )
+		{
+			const_iterator previous( *this );
+			this->operator++();
+			return previous;
+		}
+
+		/**
+		 * Pre-increment operator.
+		 * Only the elements from the lowest changed offset onward are recopied.
+		 * @return Reference to this iterator instance.
+		 */
+		const_iterator& operator++()
+		{
+			++mIterator;
+			_gather( mIterator.changedFrom() );
+			return *this;
+		}
+
+		/**
+		 * The iterator over the offsets of the selected elements.
+		 * @return Const reference to the underlying iterator.
+		 */
+		const typename BasicCombination< SizeT >::const_iterator& offsets() const
+		{
+			return mIterator;
+		}
+	};
+
+private:
+	const T* mData;
+	BasicCombination< SizeT > mCombination;
+
+public:
+	/**
+	 * Parameter constructor.
+	 * @param data Pointer to the contiguous elements to choose from.
+	 * @param numberElements Number of elements to choose from.
+	 * @param subsetSize Numer of element to choose.
+	 */
+	MaterializedCombinationView(
+		const T* data,
+		size_t numberElements,
+		size_t subsetSize ) :
+		mCombination( numberElements, subsetSize )
+	{
+		mData = data;
+	}
+
+	/**
+	 * Beginning iterator.
+	 * @return Iterator to the beginning of the enumeration.
+	 */
+	const_iterator begin() const
+	{
+		return const_iterator( mData, mCombination.begin(), mCombination.end() );
+	}
+
+	/**
+	 * End iterator.
+	 * @return Iterator to the end of the enumeration.
+	 */
+	const_iterator end() const
+	{
+		return const_iterator( mData, mCombination.end(), mCombination.end() );
+	}
+
+	/**
+	 * The combination of offsets being gathered.
+	 * @return Const reference to the combination.
+	 */
+	const BasicCombination< SizeT >& combination() const
+	{
+		return mCombination;
+	}
+
+	/**
+	 * The number of subsets.
+	 * @return N choose K.
+	 * @throw std::overflow_error if the number of subsets doesn't fit in a size_t.
+	 */
+	size_t size() const
+	{
+		return mCombination.size();
+	}
+};
+
+/**
+ * View of the K element subsets of a container, yielding references into the container.
+ * @param container Reference to the container to choose the elements of.
+ * @param subsetSize Numer of element to choose.
+ * @return CombinationView over {@param container}.
+ */
+template < typename Container >
+CombinationView< Container > combinationsOf(
+	Container& container,
+	size_t subsetSize )
+{
+	return CombinationView< Container >( container, subsetSize );
+}
+
+/**
+ * View of the K element subsets of a contiguous container, yielding
+ * each subset as a reused dense copy of the selected elements.
+ * @param container Const reference to the contiguous container to choose the elements of.
+ * @param subsetSize Numer of element to choose.
+ * @return MaterializedCombinationView over the data of {@param container}.
+ */
+template < typename Container >
+MaterializedCombinationView< typename std::remove_const< typename std::remove_pointer<
+	decltype( std::declval< const Container& >().data() ) >::type >::type > materializedCombinationsOf(
+	const Container& container,
+	size_t subsetSize )
+{
+	using T = typename std::remove_const< typename std::remove_pointer<
+		decltype( container.data() ) >::type >::type;
+	return MaterializedCombinationView< T >( container.data(), container.size(), subsetSize );
+}
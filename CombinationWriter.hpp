@@ -0,0 +1,252 @@
+/**
+ * Copyright ©2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <stdexcept>
+#include <vector>
+
+#include "CombinationFormat.hpp"
+#include "Varint.hpp"
+
+/**
+ * Class for streaming subsets out in one of the packed layouts of
+ * CombinationFormat, for replay with CombinationReader. The records are
+ * gathered into an internal buffer and written to the stream a block at
+ * a time, rather than one formatted subset at a time.
+ *
+ * As an example of use:
+ *     std::ofstream file( "subsets.cmb", std::ios::binary );
+ *     Combination combination( 40, 6 );
+ *     CombinationWriter writer( file, combination.numberElements(),
+ *         combination.subsetSize(), CombinationFormat::Indices );
+ *     writer.write( combination.begin(), combination.end() );
+ *     writer.flush();
+ *
+ * The subsets don't have to form a whole enumeration, nor appear in
+ * lexicographic order, though the Delta format is at its most compact
+ * when consecutive subsets share a long prefix.
+ *
+ * Note:
+ *   - Requires C++14 and above.
+ */
+class CombinationWriter
+{
+private:
+	std::vector< uint8_t > mBuffer;
+	size_t mCount;
+	CombinationFileHeader mHeader;
+	size_t mNumberElements;
+	std::vector< size_t > mPrevious;
+	std::ostream* mStream;
+	size_t mSubsetSize;
+
+	// The buffer is handed to the stream once it holds this many bytes.
+	static constexpr size_t _flushThreshold()
+	{
+		return size_t( 1 ) << 16;
+	}
+
+	template < typename SizeT >
+	void _writeRecord(
+		const SizeT* subset )
+	{
+		switch ( mHeader.format() )
+		{
+		case CombinationFormat::Indices:
+		{
+			size_t width = mHeader.indexWidth();
+
+			for ( size_t index = 0; index < mSubsetSize; ++index )
+			{
+				uint64_t offset = subset[ index ];
+
+				for ( size_t byte = 0; byte < width; ++byte, offset >>= 8 )
+				{
+					mBuffer.push_back( uint8_t( offset ) );
+				}
+			}
+
+			break;
+		}
+		case CombinationFormat::Bitmask:
+		{
+			size_t first = mBuffer.size();
+			mBuffer.resize( first + mHeader.recordSize(), 0 );
+
+			for ( size_t index = 0; index < mSubsetSize; ++index )
+			{
+				mBuffer[ first + subset[ index ] / 8 ] |= uint8_t( 1u << ( subset[ index ] % 8 ) );
+			}
+
+			break;
+		}
+		case CombinationFormat::Delta:
+		{
+			size_t prefix = 0;
+
+			if ( 0 != mCount % CombinationFileHeader::DeltaKeyframeInterval )
+			{
+				for ( ; ( prefix < mSubsetSize ) and ( mPrevious[ prefix ] == subset[ prefix ] ); ++prefix );
+			}
+
+			writeVarint( mBuffer, prefix );
+
+			for ( size_t index = prefix; index < mSubsetSize; ++index )
+			{
+				writeVarint( mBuffer, subset[ index ] - ( index ? subset[ index - 1 ] + 1 : 0 ) );
+				mPrevious[ index ] = subset[ index ];
+			}
+
+			break;
+		}
+		}
+
+		++mCount;
+
+		if ( _flushThreshold() <= mBuffer.size() )
+		{
+			flush();
+		}
+	}
+
+public:
+	/**
+	 * Constructor, writing the header to {@param stream}.
+	 * @param stream Reference to the stream to write to, which must outlive the writer.
+	 * @param numberElements Number of elements to choose from.
+	 * @param subsetSize Number of elements to choose, where more than N is an empty enumeration with no subsets to write.
+	 * @param format The record layout.
+	 * @param firstRank Rank of the first subset written, for a slice of an enumeration. [default: 0]
+	 */
+	CombinationWriter(
+		std::ostream& stream,
+		size_t numberElements,
+		size_t subsetSize,
+		CombinationFormat format,
+		uint64_t firstRank = 0 ) :
+		mHeader( numberElements, subsetSize, format, firstRank )
+	{
+		mCount = 0;
+		mNumberElements = numberElements;
+		mPrevious.resize( ( CombinationFormat::Delta == format ) ? subsetSize : 0 );
+		mStream = &stream;
+		mSubsetSize = subsetSize;
+
+		mBuffer.reserve( _flushThreshold() + CombinationFileHeader::Size );
+		mBuffer.resize( CombinationFileHeader::Size );
+		mHeader.encode( mBuffer.data() );
+	}
+
+	CombinationWriter( const CombinationWriter& ) = delete;
+	CombinationWriter& operator=( const CombinationWriter& ) = delete;
+
+	/**
+	 * Destructor, flushing whatever is left in the buffer.
+	 * Call flush() beforehand to see any error from the stream.
+	 */
+	~CombinationWriter()
+	{
+		try
+		{
+			flush();
+		}
+		catch ( ... )
+		{
+		}
+	}
+
+	/**
+	 * The number of subsets written.
+	 * @return The number of subsets written.
+	 */
+	size_t count() const
+	{
+		return mCount;
+	}
+
+	/**
+	 * Write out the buffered records and flush the stream.
+	 * @throw std::runtime_error if the stream fails.
+	 */
+	void flush()
+	{
+		mStream->write( reinterpret_cast< const char* >( mBuffer.data() ), std::streamsize( mBuffer.size() ) );
+		mBuffer.clear();
+		mStream->flush();
+
+		if ( not *mStream )
+		{
+			throw std::runtime_error( "failed to write the combination stream" );
+		}
+	}
+
+	/**
+	 * Write one subset.
+	 * @param subset Const pointer to the K strictly increasing offsets of the subset.
+	 * @throw std::invalid_argument if {@param subset} isn't a subset of the enumeration.
+	 */
+	template < typename SizeT >
+	void write(
+		const SizeT* subset )
+	{
+		bool isSubset = ( 0 < mSubsetSize ) and ( size_t( subset[ mSubsetSize - 1 ] ) < mNumberElements );
+
+		for ( size_t index = 1; isSubset and ( index < mSubsetSize ); ++index )
+		{
+			isSubset = subset[ index - 1 ] < subset[ index ];
+		}
+
+		if ( not isSubset )
+		{
+			throw std::invalid_argument( "subset isn't part of the enumeration" );
+		}
+
+		_writeRecord( subset );
+	}
+
+	/**
+	 * Write one subset.
+	 * @param subset Const reference to the strictly increasing offsets of the subset.
+	 * @throw std::invalid_argument if {@param subset} isn't a subset of the enumeration.
+	 */
+	template < typename SizeT, typename Allocator >
+	void write(
+		const std::vector< SizeT, Allocator >& subset )
+	{
+		if ( subset.size() != mSubsetSize )
+		{
+			throw std::invalid_argument( "subset isn't part of the enumeration" );
+		}
+
+		write( subset.data() );
+	}
+
+	/**
+	 * Write each subset of a range, such as a Combination, a Slice or a shard.
+	 * @param first Iterator to the first subset to write.
+	 * @param last Iterator one past the last subset to write.
+	 * @return The number of subsets written.
+	 * @throw std::invalid_argument if a subset isn't a subset of the enumeration.
+	 */
+	template < typename ConstIterator >
+	size_t write(
+		ConstIterator first,
+		ConstIterator last )
+	{
+		size_t count = mCount;
+
+		for ( ; first != last; ++first )
+		{
+			write( *first );
+		}
+
+		return mCount - count;
+	}
+};
@@ -0,0 +1,133 @@
+/**
+ * Copyright ©2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * Class for the table of completion counts behind the enumerations that
+ * rank by counting the ways of finishing a subset, ConstrainedCombination
+ * and MultisetCombination. Entry ( element, column ) is the number of ways
+ * to finish a subset using only elements [element, N), where the column is
+ * whatever the enumeration tracks alongside, the next position to fill or
+ * the number of offsets still to choose, from 0 to K.
+ *
+ * As an example of use, the table of N choose K, choosing {column} more:
+ *     CompletionTable table( n, k );
+ *     table.build( 0, [ & ]( size_t element, size_t column ) {
+ *         return CompletionTable::add( table.count( element + 1, column ),
+ *             column ? table.count( element + 1, column - 1 ) : 0 ); } );
+ *     size_t total = table.checkedCount( 0, k );
+ *
+ * Sums too large for a size_t saturate rather than wrap. A saturated entry
+ * only feeds into the sums before it, so the enumeration can still step
+ * forward from the counts that did fit, and checkedCount reports the rest.
+ *
+ * Note:
+ *   - Requires C++14 and above.
+ */
+class CompletionTable
+{
+private:
+	size_t mColumns;
+	std::vector< size_t > mCounts;
+	size_t mNumberElements;
+
+	static constexpr size_t _saturated()
+	{
+		return std::numeric_limits< size_t >::max();
+	}
+
+public:
+	/**
+	 * Constructor, a table of zeros.
+	 * @param numberElements Number of elements, N. [default: 0]
+	 * @param subsetSize Number of elements to choose, K, giving columns 0 .. K. [default: 0]
+	 */
+	CompletionTable(
+		size_t numberElements = 0,
+		size_t subsetSize = 0 ) :
+		mCounts( ( numberElements + 1 ) * ( subsetSize + 1 ), 0 )
+	{
+		mColumns = subsetSize + 1;
+		mNumberElements = numberElements;
+	}
+
+	/**
+	 * Add two counts, saturating.
+	 * @param augend The first count.
+	 * @param addend The second count.
+	 * @return The sum, or the largest size_t if it overflowed.
+	 */
+	static size_t add(
+		size_t augend,
+		size_t addend )
+	{
+		return ( _saturated() - augend < addend ) ? _saturated() : augend + addend;
+	}
+
+	/**
+	 * Fill the table from the last element back. With no elements left,
+	 * the only way to finish is at column {@param finished}; every other entry
+	 * is given by {@param ways}, which may read the entries of element + 1.
+	 * @param finished The column of a finished subset.
+	 * @param ways Function of ( element, column ) returning the entry, summing with add().
+	 */
+	template < typename Ways >
+	void build(
+		size_t finished,
+		Ways&& ways )
+	{
+		std::fill( mCounts.begin(), mCounts.end(), size_t( 0 ) );
+		mCounts[ mNumberElements * mColumns + finished ] = 1;
+
+		for ( size_t element = mNumberElements; element--; )
+		{
+			for ( size_t column = 0; column < mColumns; ++column )
+			{
+				mCounts[ element * mColumns + column ] = ways( element, column );
+			}
+		}
+	}
+
+	/**
+	 * The number of ways to finish from {@param element} at {@param column}, without bounds checking.
+	 * @param element The first element still to consider, at most N.
+	 * @param column The column, at most K.
+	 * @return The count, or the largest size_t if it saturated.
+	 */
+	size_t count(
+		size_t element,
+		size_t column ) const
+	{
+		return mCounts[ element * mColumns + column ];
+	}
+
+	/**
+	 * The number of ways to finish from {@param element} at {@param column}.
+	 * @param element The first element still to consider, at most N.
+	 * @param column The column, at most K.
+	 * @return The count.
+	 * @throw std::overflow_error if the count saturated.
+	 */
+	size_t checkedCount(
+		size_t element,
+		size_t column ) const
+	{
+		size_t ways = count( element, column );
+
+		if ( _saturated() == ways )
+		{
+			throw std::overflow_error( "number of subsets exceeds the range of size_t" );
+		}
+
+		return ways;
+	}
+};
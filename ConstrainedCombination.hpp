@@ -0,0 +1,648 @@
+/**
+ * Copyright ©2021-2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "CompletionTable.hpp"
+#include "Slice.hpp"
+
+/**
+ * Class for enumerating over the subset combinations of a collection
+ * that satisfy a set of constraints, without generating and filtering out
+ * the subsets that don't. The constraints are:
+ *   - require( element ), the element must be in every subset.
+ *   - exclude( element ), the element must not be in any subset.
+ *   - bound( position, lower, upper ), the offset at the given position
+ *     of the (increasing) enumeration must lie in [lower, upper].
+ *
+ * As an example of use, 5 of 20 that include 3 and 7, exclude 12 and start below 10:
+ *     ConstrainedCombination<> combination( 20, 5 );
+ *     combination.require( 3 ).require( 7 ).exclude( 12 ).bound( 0, 0, 9 );
+ *     for ( const auto& subset : combination ) {
+ *         process( subset ); }
+ *
+ * The subsets are enumerated in the same lexicographic order as Combination.
+ * For each element and number of positions filled, the number of valid
+ * completions is tabulated when the constraints are set, in O(N * K). This
+ * gives size() without enumerating, O(N) at( rank ), rank( subset ) and
+ * slice(), so the enumeration also works with parallelForEach. Loose
+ * constraints over a large N can admit more subsets than a size_t counts;
+ * iteration still steps through them, as a step only asks whether any
+ * completion remains, while size() and ranking throw std::overflow_error.
+ *
+ * Note:
+ *   - Requires C++14 and above.
+ */
+template < typename SizeT = size_t >
+class ConstrainedCombination
+{
+	static_assert( std::is_integral< SizeT >::value and std::is_unsigned< SizeT >::value,
+		"SizeT must be an unsigned integral type" );
+
+private:
+	enum ElementStatus : unsigned char
+	{
+		Free,
+		Required,
+		Excluded
+	};
+
+	/**
+	 * The constraints and the completion counts built from them. The table is
+	 * immutable once built, so it is shared between the combination and all
+	 * of its iterators.
+	 */
+	struct ConstraintTable
+	{
+		size_t numberElements;
+		size_t subsetSize;
+		std::vector< ElementStatus > status;
+		std::vector< size_t > lowerBounds;
+		std::vector< size_t > upperBounds;
+		CompletionTable completions;
+
+		ConstraintTable(
+			size_t elements,
+			size_t positions ) :
+			numberElements( elements ),
+			subsetSize( positions ),
+			status( elements, Free ),
+			lowerBounds( positions, 0 ),
+			upperBounds( positions, elements ? elements - 1 : 0 ),
+			completions( elements, positions )
+		{
+		}
+
+		bool canTake(
+			size_t element,
+			size_t position ) const
+		{
+			return ( position < subsetSize ) and ( Excluded != status[ element ] )
+				and ( lowerBounds[ position ] <= element ) and ( element <= upperBounds[ position ] );
+		}
+
+		bool canSkip(
+			size_t element ) const
+		{
+			return Required != status[ element ];
+		}
+
+		/**
+		 * The number of ways to fill positions [position, K) from elements [element, N).
+		 */
+		size_t count(
+			size_t element,
+			size_t position ) const
+		{
+			return completions.count( element, position );
+		}
+
+		void build()
+		{
+			// Every position filled is the one finished subset past the last element.
+			completions.build( subsetSize, [ this ]( size_t element, size_t position ) {
+				size_t taken = canTake( element, position ) ? count( element + 1, position + 1 ) : 0;
+				size_t skipped = canSkip( element ) ? count( element + 1, position ) : 0;
+				return CompletionTable::add( taken, skipped ); } );
+		}
+
+		/**
+		 * Fill positions [position, K) with the lexicographically smallest
+		 * valid completion of rank {@param rank} from elements [element, N).
+		 */
+		void unrank(
+			size_t element,
+			size_t position,
+			size_t rank,
+			SizeT* enumeration ) const
+		{
+			for ( ; position < subsetSize; ++element )
+			{
+				size_t taken = canTake( element, position ) ? count( element + 1, position + 1 ) : 0;
+
+				if ( rank < taken )
+				{
+					enumeration[ position++ ] = SizeT( element );
+				}
+				else
+				{
+					rank -= taken;
+				}
+			}
+		}
+	};
+
+	std::shared_ptr< ConstraintTable > mTable;
+
+	void _copyAssign(
+		const ConstrainedCombination& other )
+	{
+		mTable = other.mTable;
+	}
+
+	void _moveAssign(
+		ConstrainedCombination&& other )
+	{
+		mTable = std::exchange( other.mTable, _makeTable( 0, 0 ) );
+	}
+
+	static std::shared_ptr< ConstraintTable > _makeTable(
+		size_t numberElements,
+		size_t subsetSize )
+	{
+		auto table = std::make_shared< ConstraintTable >( numberElements, subsetSize );
+		table->build();
+		return table;
+	}
+
+	// Iterators hold on to the table they were created with, so
+	// changing a constraint builds a fresh copy of the table.
+	void _rebuild(
+		ConstraintTable&& table )
+	{
+		table.build();
+		mTable = std::make_shared< ConstraintTable >( std::move( table ) );
+	}
+
+public:
+	/**
+	 * Iterator class for enumerating over the constrained
+	 * subsets of a collection.
+	 */
+	class const_iterator
+	{
+	private:
+		friend class ConstrainedCombination;
+
+		bool mIsEnd;
+		std::shared_ptr< const ConstraintTable > mTable;
+		std::vector< SizeT > mEnumeration;
+
+		const_iterator(
+			std::shared_ptr< const ConstraintTable > table,
+			bool end,
+			size_t rank ) :
+			mTable( std::move( table ) )
+		{
+			mIsEnd = end or ( 0 == mTable->subsetSize ) or ( 0 == mTable->count( 0, 0 ) );
+
+			if ( not mIsEnd )
+			{
+				mEnumeration.resize( mTable->subsetSize );
+				mTable->unrank( 0, 0, rank, mEnumeration.data() );
+			}
+		}
+
+		void _copyAssign(
+			const const_iterator& other )
+		{
+			mIsEnd = other.mIsEnd;
+			mTable = other.mTable;
+			mEnumeration = other.mEnumeration;
+		}
+
+		void _moveAssign(
+			const_iterator&& other )
+		{
+			mIsEnd = std::exchange( other.mIsEnd, true );
+			mTable = std::move( other.mTable );
+			mEnumeration = std::move( other.mEnumeration );
+		}
+
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using difference_type   = std::ptrdiff_t;
+		using value_type        = const std::vector< SizeT >;
+		using pointer           = const std::vector< SizeT >*;
+		using reference         = const std::vector< SizeT >&;
+
+		/**
+		 * Default constructor.
+		 */
+		const_iterator()
+		{
+			mIsEnd = true;
+		}
+
+		/**
+		 * Move constructor.
+		 * @param other R-Value to the iterator to move.
+		 */
+		const_iterator(
+			const_iterator&& other )
+		{
+			_moveAssign( std::move( other ) );
+		}
+
+		/**
+		 * Copy constructor.
+		 * @param other Const reference to the iterator to copy.
+		 */
+		const_iterator(
+			const const_iterator& other )
+		{
+			_copyAssign( other );
+		}
+
+		/**
+		 * Move assignment.
+		 * @param other R-Value to the iterator to move.
+		 * @return Reference to this iterator instance.
+		 */
+		const_iterator& operator=(
+			const_iterator&& other )
+		{
+			if ( this != &other )
+			{
+				_moveAssign( std::move( other ) );
+			}
+
+			return *this;
+		}
+
+		/**
+		 * Copy assignment.
+		 * @param other Const reference to the iterator to copy.
+		 * @return Reference to this iterator instance.
+		 */
+		const_iterator& operator=(
+			const const_iterator& other )
+		{
+			if ( this != &other )
+			{
+				_copyAssign( other );
+			}
+
+			return *this;
+		}
+
+		/**
+		 * Equality operator.
+		 * Comparing against an end iterator only tests the end flags.
+		 * @param other Const reference to the iterator to compare against.
+		 * @return Return true if {@param other} compares equal to this iterator instance.
+		 */
+		bool operator==(
+			const const_iterator& other ) const
+		{
+			if ( mIsEnd or other.mIsEnd )
+			{
+				return ( mIsEnd == other.mIsEnd ) and ( mTable == other.mTable );
+			}
+
+			return ( mTable == other.mTable )
+				and std::equal( mEnumeration.rbegin(), mEnumeration.rend(), other.mEnumeration.rbegin() );
+		}
+
+		/**
+		 * Inequality operator.
+		 * @param other Const reference to the iterator to compare against.
+		 * @return Return true if {@param other} compares not equal to this iterator instance.
+		 */
+		bool operator!=(
+			const const_iterator& other ) const
+		{
+			return not this->operator==( other );
+		}
+
+		/**
+		 * Member redirect.
+		 * @return Const pointer to the enumeration.
+		 */
+		pointer operator->() const
+		{
+			return &mEnumeration;
+		}
+
+		/**
+		 * Dereference operator.
+		 * @return Const reference to the enumeration.
+		 */
+		reference operator*() const
+		{
+			return mEnumeration;
+		}
+
+		/**
+		 * Post-increment operator.
+		 * @return iterator to the prior enumeration.
+		 */
+		const_iterator operator++( int )
+		{
+			const_iterator previous( *this );
+			this->operator++();
+			return previous;
+		}
+
+		/**
+		 * Pre-increment operator.
+		 * Finds the deepest position whose offset can be passed over while
+		 * still leaving a valid completion, then fills in the smallest one.
+		 * @return Reference to this iterator instance.
+		 */
+		const_iterator& operator++()
+		{
+			for ( size_t position = mEnumeration.size(); position--; )
+			{
+				size_t element = mEnumeration[ position ];
+
+				if ( mTable->canSkip( element ) and ( 0 < mTable->count( element + 1, position ) ) )
+				{
+					mTable->unrank( element + 1, position, 0, mEnumeration.data() );
+					return *this;
+				}
+			}
+
+			mIsEnd = true;
+			return *this;
+		}
+
+		/**
+		 * Swap this iterator with another.
+		 * @param other Reference to the iterator to swap with.
+		 */
+		void swap(
+			const_iterator& other )
+		{
+			std::swap( mIsEnd, other.mIsEnd );
+			std::swap( mTable, other.mTable );
+			std::swap( mEnumeration, other.mEnumeration );
+		}
+	};
+
+	/**
+	 * Default constructor, with no constraints beyond the subset size.
+	 * @param numberElements Number of elements to choose from. [default: 0]
+	 * @param subsetSize Numer of element to choose. [default: 0]
+	 * @throw std::invalid_argument if the offsets of {@param numberElements} can't be represented by SizeT.
+	 */
+	ConstrainedCombination(
+		size_t numberElements = 0,
+		size_t subsetSize = 0 )
+	{
+		if ( ( 0 < numberElements ) and ( std::numeric_limits< SizeT >::max() < numberElements - 1 ) )
+		{
+			throw std::invalid_argument( "numberElements exceeds the range of SizeT" );
+		}
+
+		mTable = _makeTable( numberElements, subsetSize );
+	}
+
+	/**
+	 * Move constructor.
+	 * @param other R-Value to the ConstrainedCombination to move.
+	 */
+	ConstrainedCombination(
+		ConstrainedCombination&& other )
+	{
+		_moveAssign( std::move( other ) );
+	}
+
+	/**
+	 * Copy constructor.
+	 * @param other Const reference to the ConstrainedCombination to copy.
+	 */
+	ConstrainedCombination(
+		const ConstrainedCombination& other )
+	{
+		_copyAssign( other );
+	}
+
+	/**
+	 * The subset at the given rank of the enumeration.
+	 * @param rank Lexicographic rank of the subset, starting from 0.
+	 * @return Vector of offsets of the subset.
+	 * @throw std::out_of_range if {@param rank} isn't less than size().
+	 * @throw std::overflow_error if the number of subsets doesn't fit in a size_t.
+	 */
+	std::vector< SizeT > at(
+		size_t rank ) const
+	{
+		if ( size() <= rank )
+		{
+			throw std::out_of_range( "rank is outside of the enumeration" );
+		}
+
+		std::vector< SizeT > subset( mTable->subsetSize );
+		mTable->unrank( 0, 0, rank, subset.data() );
+		return subset;
+	}
+
+	/**
+	 * Beginning iterator.
+	 * @return Iterator to the beginning of the combination enumeration.
+	 */
+	const_iterator begin() const
+	{
+		return const_iterator( mTable, false, 0 );
+	}
+
+	/**
+	 * Constrain the offset at a position of the enumeration to a range.
+	 * @param position The position within the subset, less than K.
+	 * @param lower The smallest offset allowed at {@param position}.
+	 * @param upper The largest offset allowed at {@param position}.
+	 * @return Reference to this ConstrainedCombination object is returned.
+	 * @throw std::out_of_range if {@param position} isn't less than K.
+	 */
+	ConstrainedCombination& bound(
+		size_t position,
+		size_t lower,
+		size_t upper )
+	{
+		if ( mTable->subsetSize <= position )
+		{
+			throw std::out_of_range( "position is outside of the subset" );
+		}
+
+		ConstraintTable table( *mTable );
+		table.lowerBounds[ position ] = lower;
+		table.upperBounds[ position ] = upper;
+		_rebuild( std::move( table ) );
+		return *this;
+	}
+
+	/**
+	 * End iterator.
+	 * @return Iterator to the end of the combination enumeration.
+	 */
+	const_iterator end() const
+	{
+		return const_iterator( mTable, true, 0 );
+	}
+
+	/**
+	 * Exclude an element from every subset. This replaces
+	 * an earlier require() of the same element.
+	 * @param element Offset of the element to exclude.
+	 * @return Reference to this ConstrainedCombination object is returned.
+	 * @throw std::out_of_range if {@param element} isn't less than N.
+	 */
+	ConstrainedCombination& exclude(
+		size_t element )
+	{
+		if ( mTable->numberElements <= element )
+		{
+			throw std::out_of_range( "element is outside of the collection" );
+		}
+
+		ConstraintTable table( *mTable );
+		table.status[ element ] = Excluded;
+		_rebuild( std::move( table ) );
+		return *this;
+	}
+
+	/**
+	 * The number of elements.
+	 * @return The number of elements.
+	 */
+	size_t numberElements() const
+	{
+		return mTable->numberElements;
+	}
+
+	/**
+	 * Move assignment operator.
+	 * @param other R-Value to the ConstrainedCombination object to move to this instance.
+	 * @return Reference to this ConstrainedCombination object is returned.
+	 */
+	ConstrainedCombination& operator=(
+		ConstrainedCombination&& other )
+	{
+		if ( this != &other )
+		{
+			_moveAssign( std::move( other ) );
+		}
+
+		return *this;
+	}
+
+	/**
+	 * Copy assignment operator.
+	 * @param other Const reference to the ConstrainedCombination object to copy to this instance.
+	 * @return Reference to this ConstrainedCombination object is returned.
+	 */
+	ConstrainedCombination& operator=(
+		const ConstrainedCombination& other )
+	{
+		if ( this != &other )
+		{
+			_copyAssign( other );
+		}
+
+		return *this;
+	}
+
+	/**
+	 * The rank of a subset within the enumeration.
+	 * @param subset Const reference to the strictly increasing offsets of the subset.
+	 * @return Lexicographic rank of {@param subset}, starting from 0.
+	 * @throw std::invalid_argument if {@param subset} isn't part of the enumeration.
+	 * @throw std::overflow_error if the number of subsets doesn't fit in a size_t.
+	 */
+	size_t rank(
+		const std::vector< SizeT >& subset ) const
+	{
+		size_t total = size();
+		size_t rank = 0;
+		size_t position = 0;
+		bool isSubset = ( 0 < total ) and ( subset.size() == mTable->subsetSize );
+
+		for ( size_t element = 0; isSubset and ( element < mTable->numberElements ); ++element )
+		{
+			if ( ( position < subset.size() ) and ( subset[ position ] == element ) )
+			{
+				isSubset = mTable->canTake( element, position++ );
+			}
+			else
+			{
+				isSubset = mTable->canSkip( element );
+				rank += mTable->canTake( element, position ) ? mTable->count( element + 1, position + 1 ) : 0;
+			}
+		}
+
+		if ( not isSubset or ( position != subset.size() ) )
+		{
+			throw std::invalid_argument( "subset isn't part of the enumeration" );
+		}
+
+		return rank;
+	}
+
+	/**
+	 * Require an element to be in every subset. This replaces
+	 * an earlier exclude() of the same element.
+	 * @param element Offset of the element to require.
+	 * @return Reference to this ConstrainedCombination object is returned.
+	 * @throw std::out_of_range if {@param element} isn't less than N.
+	 */
+	ConstrainedCombination& require(
+		size_t element )
+	{
+		if ( mTable->numberElements <= element )
+		{
+			throw std::out_of_range( "element is outside of the collection" );
+		}
+
+		ConstraintTable table( *mTable );
+		table.status[ element ] = Required;
+		_rebuild( std::move( table ) );
+		return *this;
+	}
+
+	/**
+	 * The number of subsets satisfying the constraints, computed without enumerating.
+	 * @return The number of subsets in the enumeration.
+	 * @throw std::overflow_error if the number of subsets doesn't fit in a size_t.
+	 */
+	size_t size() const
+	{
+		return ( 0 < mTable->subsetSize ) ? mTable->completions.checkedCount( 0, 0 ) : 0;
+	}
+
+	/**
+	 * A contiguous sub-range of the enumeration.
+	 * @param firstRank Rank of the first subset of the slice.
+	 * @param count Number of subsets in the slice.
+	 * @return Slice over the subsets of rank [firstRank, firstRank + count).
+	 * @throw std::out_of_range if the slice extends past the end of the enumeration.
+	 * @throw std::overflow_error if the number of subsets doesn't fit in a size_t.
+	 */
+	Slice< const_iterator > slice(
+		size_t firstRank,
+		size_t count ) const
+	{
+		size_t total = size();
+
+		if ( ( total < firstRank ) or ( total - firstRank < count ) )
+		{
+			throw std::out_of_range( "slice is outside of the enumeration" );
+		}
+
+		return Slice< const_iterator >(
+			const_iterator( mTable, total == firstRank, firstRank ),
+			const_iterator( mTable, total == firstRank + count, firstRank + count ),
+			firstRank, count );
+	}
+
+	/**
+	 * The number of elements to choose from.
+	 * @return The subset size.
+	 */
+	size_t subsetSize() const
+	{
+		return mTable->subsetSize;
+	}
+};
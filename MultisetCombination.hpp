@@ -0,0 +1,624 @@
+/**
+ * Copyright ©2021-2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "CompletionTable.hpp"
+#include "Slice.hpp"
+
+/**
+ * Class for enumerating over the K element combinations of a multiset,
+ * where element i may be chosen up to multiplicity( i ) times, or any
+ * number of times for combinations with repetition. Each subset is the
+ * non-decreasing sequence of its offsets, so choosing offset 0 twice and
+ * offset 2 once gives [ 0, 0, 2 ].
+ *
+ * As an example of use:
+ *     // Choose 3 from { a, a, b, c, c, c }.
+ *     MultisetCombination<> combination( std::vector< size_t > { 2, 1, 3 }, 3 );
+ *     for ( const auto& subset : combination ) {
+ *         process( subset ); }
+ *
+ *     // Choose 4 from 5 with repetition.
+ *     MultisetCombination<> repetition( 5, 4 );
+ *
+ * The subsets are enumerated in lexicographic order, starting from the
+ * smallest offsets taken as many times as allowed. Each distinct subset
+ * is produced exactly once, and the number of ways to complete a subset
+ * from each element onwards is tabulated on construction, giving size(),
+ * at( rank ), rank( subset ) and slice(). With repetition the count is
+ * N + K - 1 choose K, soon too large for a size_t, at which point size()
+ * and the rank based methods throw std::overflow_error, though stepping
+ * through the subsets in order carries on. For N = 0 or
+ * K = 0, or when the multiset holds fewer than K elements, there is no
+ * enumeration.
+ *
+ * Note:
+ *   - Requires C++14 and above.
+ */
+template < typename SizeT = size_t >
+class MultisetCombination
+{
+	static_assert( std::is_integral< SizeT >::value and std::is_unsigned< SizeT >::value,
+		"SizeT must be an unsigned integral type" );
+
+private:
+	/**
+	 * The multiplicities and the completion counts built from them. The
+	 * table is immutable once built, so it is shared between the
+	 * combination and all of its iterators.
+	 */
+	struct MultiplicityTable
+	{
+		size_t numberElements;
+		size_t subsetSize;
+		std::vector< size_t > multiplicities;
+		std::vector< size_t > nextAvailable;
+		std::vector< size_t > suffixCapacity;
+		CompletionTable completions;
+
+		MultiplicityTable(
+			std::vector< size_t > elementMultiplicities,
+			size_t positions ) :
+			numberElements( elementMultiplicities.size() ),
+			subsetSize( positions ),
+			multiplicities( std::move( elementMultiplicities ) ),
+			completions( numberElements, subsetSize )
+		{
+			// Nothing is gained from a multiplicity beyond K.
+			for ( auto& multiplicity : multiplicities )
+			{
+				multiplicity = std::min( multiplicity, subsetSize );
+			}
+
+			nextAvailable.assign( numberElements + 1, numberElements );
+			suffixCapacity.assign( numberElements + 1, 0 );
+
+			for ( size_t element = numberElements; element--; )
+			{
+				nextAvailable[ element ] = ( 0 < multiplicities[ element ] ) ? element : nextAvailable[ element + 1 ];
+				suffixCapacity[ element ] = std::min( subsetSize, suffixCapacity[ element + 1 ] + multiplicities[ element ] );
+			}
+
+			// Nothing left to choose is the one finished subset past the last element.
+			completions.build( 0, [ this ]( size_t element, size_t remaining ) {
+				size_t total = 0;
+
+				for ( size_t copies = 0; copies <= std::min( multiplicities[ element ], remaining ); ++copies )
+				{
+					total = CompletionTable::add( total, count( element + 1, remaining - copies ) );
+				}
+
+				return total; } );
+		}
+
+		/**
+		 * The number of ways to choose {@param remaining} from elements [element, N).
+		 */
+		size_t count(
+			size_t element,
+			size_t remaining ) const
+		{
+			return completions.count( element, remaining );
+		}
+
+		/**
+		 * Fill positions [position, K) with the smallest
+		 * offsets available from {@param element} onward.
+		 */
+		void fill(
+			size_t element,
+			size_t copies,
+			size_t position,
+			SizeT* enumeration ) const
+		{
+			for ( ; position < subsetSize; ++position, ++copies )
+			{
+				if ( copies == multiplicities[ element ] )
+				{
+					element = nextAvailable[ element + 1 ];
+					copies = 0;
+				}
+
+				enumeration[ position ] = SizeT( element );
+			}
+		}
+
+		/**
+		 * Fill the subset of rank {@param rank} into {@param enumeration}.
+		 */
+		void unrank(
+			size_t rank,
+			SizeT* enumeration ) const
+		{
+			size_t position = 0;
+
+			for ( size_t element = 0; position < subsetSize; ++element )
+			{
+				size_t remaining = subsetSize - position;
+
+				// More copies of a smaller offset come first lexicographically.
+				for ( size_t copies = std::min( multiplicities[ element ], remaining ); ; --copies )
+				{
+					size_t ways = count( element + 1, remaining - copies );
+
+					if ( rank < ways )
+					{
+						std::fill_n( enumeration + position, copies, SizeT( element ) );
+						position += copies;
+						break;
+					}
+
+					rank -= ways;
+				}
+			}
+		}
+	};
+
+	std::shared_ptr< const MultiplicityTable > mTable;
+
+	void _copyAssign(
+		const MultisetCombination& other )
+	{
+		mTable = other.mTable;
+	}
+
+	void _moveAssign(
+		MultisetCombination&& other )
+	{
+		mTable = std::exchange( other.mTable,
+			std::make_shared< const MultiplicityTable >( std::vector< size_t >(), 0 ) );
+	}
+
+	static void _validate(
+		size_t numberElements )
+	{
+		if ( ( 0 < numberElements ) and ( std::numeric_limits< SizeT >::max() < numberElements - 1 ) )
+		{
+			throw std::invalid_argument( "numberElements exceeds the range of SizeT" );
+		}
+	}
+
+public:
+	/**
+	 * Iterator class for enumerating over the
+	 * combinations of a multiset.
+	 */
+	class const_iterator
+	{
+	private:
+		friend class MultisetCombination;
+
+		bool mIsEnd;
+		std::shared_ptr< const MultiplicityTable > mTable;
+		std::vector< SizeT > mEnumeration;
+
+		const_iterator(
+			std::shared_ptr< const MultiplicityTable > table,
+			bool end,
+			size_t rank ) :
+			mTable( std::move( table ) )
+		{
+			mIsEnd = end or ( 0 == mTable->subsetSize ) or ( 0 == mTable->count( 0, mTable->subsetSize ) );
+
+			if ( not mIsEnd )
+			{
+				mEnumeration.resize( mTable->subsetSize );
+				mTable->unrank( rank, mEnumeration.data() );
+			}
+		}
+
+		void _copyAssign(
+			const const_iterator& other )
+		{
+			mIsEnd = other.mIsEnd;
+			mTable = other.mTable;
+			mEnumeration = other.mEnumeration;
+		}
+
+		void _moveAssign(
+			const_iterator&& other )
+		{
+			mIsEnd = std::exchange( other.mIsEnd, true );
+			mTable = std::move( other.mTable );
+			mEnumeration = std::move( other.mEnumeration );
+		}
+
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using difference_type   = std::ptrdiff_t;
+		using value_type        = const std::vector< SizeT >;
+		using pointer           = const std::vector< SizeT >*;
+		using reference         = const std::vector< SizeT >&;
+
+		/**
+		 * Default constructor.
+		 */
+		const_iterator()
+		{
+			mIsEnd = true;
+		}
+
+		/**
+		 * Move constructor.
+		 * @param other R-Value to the iterator to move.
+		 */
+		const_iterator(
+			const_iterator&& other )
+		{
+			_moveAssign( std::move( other ) );
+		}
+
+		/**
+		 * Copy constructor.
+		 * @param other Const reference to the iterator to copy.
+		 */
+		const_iterator(
+			const const_iterator& other )
+		{
+			_copyAssign( other );
+		}
+
+		/**
+		 * Move assignment.
+		 * @param other R-Value to the iterator to move.
+		 * @return Reference to this iterator instance.
+		 */
+		const_iterator& operator=(
+			const_iterator&& other )
+		{
+			if ( this != &other )
+			{
+				_moveAssign( std::move( other ) );
+			}
+
+			return *this;
+		}
+
+		/**
+		 * Copy assignment.
+		 * @param other Const reference to the iterator to copy.
+		 * @return Reference to this iterator instance.
+		 */
+		const_iterator& operator=(
+			const const_iterator& other )
+		{
+			if ( this != &other )
+			{
+				_copyAssign( other );
+			}
+
+			return *this;
+		}
+
+		/**
+		 * Equality operator.
+		 * Comparing against an end iterator only tests the end flags.
+		 * @param other Const reference to the iterator to compare against.
+		 * @return Return true if {@param other} compares equal to this iterator instance.
+		 */
+		bool operator==(
+			const const_iterator& other ) const
+		{
+			if ( mIsEnd or other.mIsEnd )
+			{
+				return ( mIsEnd == other.mIsEnd ) and ( mTable == other.mTable );
+			}
+
+			return ( mTable == other.mTable )
+				and std::equal( mEnumeration.rbegin(), mEnumeration.rend(), other.mEnumeration.rbegin() );
+		}
+
+		/**
+		 * Inequality operator.
+		 * @param other Const reference to the iterator to compare against.
+		 * @return Return true if {@param other} compares not equal to this iterator instance.
+		 */
+		bool operator!=(
+			const const_iterator& other ) const
+		{
+			return not this->operator==( other );
+		}
+
+		/**
+		 * Member redirect.
+		 * @return Const pointer to the enumeration.
+		 */
+		pointer operator->() const
+		{
+			return &mEnumeration;
+		}
+
+		/**
+		 * Dereference operator.
+		 * @return Const reference to the enumeration.
+		 */
+		reference operator*() const
+		{
+			return mEnumeration;
+		}
+
+		/**
+		 * Post-increment operator.
+		 * @return iterator to the prior enumeration.
+		 */
+		const_iterator operator++( int )
+		{
+			const_iterator previous( *this );
+			this->operator++();
+			return previous;
+		}
+
+		/**
+		 * Pre-increment operator.
+		 * Finds the deepest position whose offset can be raised to the next
+		 * available element while still leaving enough capacity after it,
+		 * then fills in the smallest offsets from there.
+		 * @return Reference to this iterator instance.
+		 */
+		const_iterator& operator++()
+		{
+			for ( size_t position = mEnumeration.size(); position--; )
+			{
+				size_t element = mTable->nextAvailable[ mEnumeration[ position ] + 1 ];
+
+				if ( ( element < mTable->numberElements )
+					and ( mEnumeration.size() - position <= mTable->suffixCapacity[ element ] ) )
+				{
+					mTable->fill( element, 0, position, mEnumeration.data() );
+					return *this;
+				}
+			}
+
+			mIsEnd = true;
+			return *this;
+		}
+
+		/**
+		 * Swap this iterator with another.
+		 * @param other Reference to the iterator to swap with.
+		 */
+		void swap(
+			const_iterator& other )
+		{
+			std::swap( mIsEnd, other.mIsEnd );
+			std::swap( mTable, other.mTable );
+			std::swap( mEnumeration, other.mEnumeration );
+		}
+	};
+
+	/**
+	 * Default constructor, combinations with repetition.
+	 * @param numberElements Number of elements to choose from, each any number of times. [default: 0]
+	 * @param subsetSize Numer of element to choose. [default: 0]
+	 * @throw std::invalid_argument if the offsets of {@param numberElements} can't be represented by SizeT.
+	 */
+	MultisetCombination(
+		size_t numberElements = 0,
+		size_t subsetSize = 0 )
+	{
+		_validate( numberElements );
+		mTable = std::make_shared< const MultiplicityTable >(
+			std::vector< size_t >( numberElements, subsetSize ), subsetSize );
+	}
+
+	/**
+	 * Parameter constructor, combinations of a multiset.
+	 * @param multiplicities The number of times each element may be chosen.
+	 * @param subsetSize Numer of element to choose.
+	 * @throw std::invalid_argument if the offsets of {@param multiplicities} can't be represented by SizeT.
+	 */
+	MultisetCombination(
+		std::vector< size_t > multiplicities,
+		size_t subsetSize )
+	{
+		_validate( multiplicities.size() );
+		mTable = std::make_shared< const MultiplicityTable >( std::move( multiplicities ), subsetSize );
+	}
+
+	/**
+	 * Move constructor.
+	 * @param other R-Value to the MultisetCombination to move.
+	 */
+	MultisetCombination(
+		MultisetCombination&& other )
+	{
+		_moveAssign( std::move( other ) );
+	}
+
+	/**
+	 * Copy constructor.
+	 * @param other Const reference to the MultisetCombination to copy.
+	 */
+	MultisetCombination(
+		const MultisetCombination& other )
+	{
+		_copyAssign( other );
+	}
+
+	/**
+	 * The subset at the given rank of the enumeration.
+	 * @param rank Lexicographic rank of the subset, starting from 0.
+	 * @return Vector of offsets of the subset.
+	 * @throw std::out_of_range if {@param rank} isn't less than size().
+	 * @throw std::overflow_error if the number of subsets doesn't fit in a size_t.
+	 */
+	std::vector< SizeT > at(
+		size_t rank ) const
+	{
+		if ( size() <= rank )
+		{
+			throw std::out_of_range( "rank is outside of the enumeration" );
+		}
+
+		std::vector< SizeT > subset( mTable->subsetSize );
+		mTable->unrank( rank, subset.data() );
+		return subset;
+	}
+
+	/**
+	 * Beginning iterator.
+	 * @return Iterator to the beginning of the combination enumeration.
+	 */
+	const_iterator begin() const
+	{
+		return const_iterator( mTable, false, 0 );
+	}
+
+	/**
+	 * End iterator.
+	 * @return Iterator to the end of the combination enumeration.
+	 */
+	const_iterator end() const
+	{
+		return const_iterator( mTable, true, 0 );
+	}
+
+	/**
+	 * The number of times an element may be chosen, capped at K.
+	 * @param element Offset of the element.
+	 * @return The multiplicity of {@param element}.
+	 * @throw std::out_of_range if {@param element} isn't less than N.
+	 */
+	size_t multiplicity(
+		size_t element ) const
+	{
+		return mTable->multiplicities.at( element );
+	}
+
+	/**
+	 * The number of distinct elements.
+	 * @return The number of elements.
+	 */
+	size_t numberElements() const
+	{
+		return mTable->numberElements;
+	}
+
+	/**
+	 * Move assignment operator.
+	 * @param other R-Value to the MultisetCombination object to move to this instance.
+	 * @return Reference to this MultisetCombination object is returned.
+	 */
+	MultisetCombination& operator=(
+		MultisetCombination&& other )
+	{
+		if ( this != &other )
+		{
+			_moveAssign( std::move( other ) );
+		}
+
+		return *this;
+	}
+
+	/**
+	 * Copy assignment operator.
+	 * @param other Const reference to the MultisetCombination object to copy to this instance.
+	 * @return Reference to this MultisetCombination object is returned.
+	 */
+	MultisetCombination& operator=(
+		const MultisetCombination& other )
+	{
+		if ( this != &other )
+		{
+			_copyAssign( other );
+		}
+
+		return *this;
+	}
+
+	/**
+	 * The rank of a subset within the enumeration.
+	 * @param subset Const reference to the non-decreasing offsets of the subset.
+	 * @return Lexicographic rank of {@param subset}, starting from 0.
+	 * @throw std::invalid_argument if {@param subset} isn't part of the enumeration.
+	 * @throw std::overflow_error if the number of subsets doesn't fit in a size_t.
+	 */
+	size_t rank(
+		const std::vector< SizeT >& subset ) const
+	{
+		size_t total = size();
+		size_t rank = 0;
+		size_t position = 0;
+		bool isSubset = ( 0 < total ) and ( subset.size() == mTable->subsetSize );
+
+		for ( size_t element = 0; isSubset and ( element < mTable->numberElements ); ++element )
+		{
+			size_t remaining = subset.size() - position;
+			size_t copies = 0;
+
+			for ( ; ( position < subset.size() ) and ( subset[ position ] == element ); ++position, ++copies );
+
+			isSubset = ( copies <= mTable->multiplicities[ element ] );
+
+			// Every subset taking more copies of this element comes first.
+			for ( size_t more = copies + 1; isSubset and ( more <= std::min( mTable->multiplicities[ element ], remaining ) ); ++more )
+			{
+				rank += mTable->count( element + 1, remaining - more );
+			}
+		}
+
+		if ( not isSubset or ( position != subset.size() ) )
+		{
+			throw std::invalid_argument( "subset isn't part of the enumeration" );
+		}
+
+		return rank;
+	}
+
+	/**
+	 * The number of distinct subsets, computed without enumerating.
+	 * @return The number of subsets in the enumeration.
+	 * @throw std::overflow_error if the number of subsets doesn't fit in a size_t.
+	 */
+	size_t size() const
+	{
+		return ( 0 < mTable->subsetSize ) ? mTable->completions.checkedCount( 0, mTable->subsetSize ) : 0;
+	}
+
+	/**
+	 * A contiguous sub-range of the enumeration.
+	 * @param firstRank Rank of the first subset of the slice.
+	 * @param count Number of subsets in the slice.
+	 * @return Slice over the subsets of rank [firstRank, firstRank + count).
+	 * @throw std::out_of_range if the slice extends past the end of the enumeration.
+	 * @throw std::overflow_error if the number of subsets doesn't fit in a size_t.
+	 */
+	Slice< const_iterator > slice(
+		size_t firstRank,
+		size_t count ) const
+	{
+		size_t total = size();
+
+		if ( ( total < firstRank ) or ( total - firstRank < count ) )
+		{
+			throw std::out_of_range( "slice is outside of the enumeration" );
+		}
+
+		return Slice< const_iterator >(
+			const_iterator( mTable, total == firstRank, firstRank ),
+			const_iterator( mTable, total == firstRank + count, firstRank + count ),
+			firstRank, count );
+	}
+
+	/**
+	 * The number of elements to choose.
+	 * @return The subset size.
+	 */
+	size_t subsetSize() const
+	{
+		return mTable->subsetSize;
+	}
+};
@@ -0,0 +1,688 @@
+/**
+ * Copyright ©2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "BinomialCoefficient.hpp"
+#include "Combination.hpp"
+#include "Slice.hpp"
+
+/**
+ * The elements the inner subsets of a NestedCombination are chosen from.
+ */
+enum class NestedCombinationSource : uint8_t
+{
+	// The N - K1 elements left out of the outer subset.
+	Complement,
+
+	// The K1 elements of the outer subset.
+	Chosen
+};
+
+/**
+ * Class for enumerating over two nested levels of subset combinations:
+ * each subset of Combination( N, K1 ), in the same order, is followed by
+ * every subset of K2 of either its complement or its own elements, again
+ * in lexicographic order. This fuses the nested loop that builds a fresh
+ * complement and a fresh inner Combination for every outer subset.
+ *
+ * The iterator holds one buffer per level, reused throughout. As the outer
+ * subset steps on, only the complement entries between the first offset
+ * that changed and the last offset of the subset are rewritten, so an outer
+ * step costs the span of the change rather than O(N), and an inner step the
+ * offsets it changes.
+ *
+ * As an example of use, splitting 10 players into teams of 5, 3 and 2:
+ *     NestedCombination<> splits( 10, 5, 3 );
+ *     for ( auto split = splits.begin(); split != splits.end(); ++split ) {
+ *         evaluate( split.outer(), *split ); }
+ *
+ * Dereferencing gives the K2 offsets of the inner subset, as offsets of
+ * the N elements rather than of the complement or of the outer subset.
+ * The rank of a pair is the rank of its outer subset times the number of
+ * inner subsets plus the rank of its inner subset, giving size() and
+ * slice(), so the enumeration can be split across threads.
+ *
+ * Note:
+ *   - Requires C++14 and above.
+ */
+template < typename SizeT = size_t >
+class NestedCombination
+{
+	static_assert( std::is_integral< SizeT >::value and std::is_unsigned< SizeT >::value,
+		"SizeT must be an unsigned integral type" );
+
+private:
+	size_t mInnerSize;
+	size_t mNumberElements;
+	size_t mOuterSize;
+	NestedCombinationSource mSource;
+
+	void _copyAssign(
+		const NestedCombination& other )
+	{
+		mInnerSize = other.mInnerSize;
+		mNumberElements = other.mNumberElements;
+		mOuterSize = other.mOuterSize;
+		mSource = other.mSource;
+	}
+
+	void _moveAssign(
+		NestedCombination&& other )
+	{
+		mInnerSize = std::exchange( other.mInnerSize, 0 );
+		mNumberElements = std::exchange( other.mNumberElements, 0 );
+		mOuterSize = std::exchange( other.mOuterSize, 0 );
+		mSource = std::exchange( other.mSource, NestedCombinationSource::Complement );
+	}
+
+	// The number of elements the inner subsets are chosen from.
+	static size_t _sourceSize(
+		size_t numberElements,
+		size_t outerSize,
+		NestedCombinationSource source )
+	{
+		return ( NestedCombinationSource::Complement == source ) ? numberElements - outerSize : outerSize;
+	}
+
+	// The number of subsets of Combination( numberElements, subsetSize ).
+	static size_t _count(
+		size_t numberElements,
+		size_t subsetSize )
+	{
+		size_t count = 0;
+
+		if ( ( 0 < subsetSize ) and ( subsetSize <= numberElements )
+			and not binomialCoefficient( numberElements, subsetSize, count ) )
+		{
+			throw std::overflow_error( "number of subsets exceeds the range of size_t" );
+		}
+
+		return count;
+	}
+
+	static size_t _size(
+		size_t numberElements,
+		size_t outerSize,
+		size_t innerSize,
+		NestedCombinationSource source )
+	{
+		size_t outerCount = _count( numberElements, outerSize );
+
+		if ( 0 == outerCount )
+		{
+			return 0;
+		}
+
+		size_t innerCount = _count( _sourceSize( numberElements, outerSize, source ), innerSize );
+
+		if ( ( 0 < innerCount ) and ( ( std::numeric_limits< size_t >::max() / innerCount ) < outerCount ) )
+		{
+			throw std::overflow_error( "number of subsets exceeds the range of size_t" );
+		}
+
+		return outerCount * innerCount;
+	}
+
+public:
+	/**
+	 * Iterator class for enumerating over the nested
+	 * subsets of a collection.
+	 */
+	class const_iterator
+	{
+	private:
+		friend class NestedCombination;
+
+		std::vector< SizeT > mComplement;
+		std::vector< SizeT > mInner;
+		std::vector< SizeT > mInnerIndices;
+		size_t mInnerSize;
+		bool mIsEnd;
+		size_t mNumberElements;
+		std::vector< SizeT > mOuter;
+		bool mOuterChanged;
+		size_t mOuterSize;
+		NestedCombinationSource mSource;
+
+		const_iterator(
+			bool end,
+			size_t numberElements,
+			size_t outerSize,
+			size_t innerSize,
+			NestedCombinationSource source,
+			size_t rank )
+		{
+			mInnerSize = innerSize;
+			mIsEnd = end;
+			mNumberElements = numberElements;
+			mOuterChanged = true;
+			mOuterSize = outerSize;
+			mSource = source;
+
+			if ( not mIsEnd and ( 0 < _size( numberElements, outerSize, innerSize, source ) ) )
+			{
+				size_t sourceSize = _sourceSize( numberElements, outerSize, source );
+				size_t innerCount = _count( sourceSize, innerSize );
+
+				mOuter = BasicCombination< SizeT >( numberElements, outerSize ).at( rank / innerCount );
+				mComplement.reserve( numberElements - outerSize );
+
+				for ( size_t element = 0, index = 0; element < numberElements; ++element )
+				{
+					if ( ( index < outerSize ) and ( mOuter[ index ] == element ) )
+					{
+						++index;
+					}
+					else
+					{
+						mComplement.push_back( SizeT( element ) );
+					}
+				}
+
+				mInnerIndices = BasicCombination< SizeT >( sourceSize, innerSize ).at( rank % innerCount );
+				mInner.resize( innerSize );
+				_gatherInner( 0 );
+			}
+			else
+			{
+				mIsEnd = true;
+			}
+		}
+
+		void _copyAssign(
+			const const_iterator& other )
+		{
+			mComplement = other.mComplement;
+			mInner = other.mInner;
+			mInnerIndices = other.mInnerIndices;
+			mInnerSize = other.mInnerSize;
+			mIsEnd = other.mIsEnd;
+			mNumberElements = other.mNumberElements;
+			mOuter = other.mOuter;
+			mOuterChanged = other.mOuterChanged;
+			mOuterSize = other.mOuterSize;
+			mSource = other.mSource;
+		}
+
+		void _moveAssign(
+			const_iterator&& other )
+		{
+			mComplement = std::move( other.mComplement );
+			mInner = std::move( other.mInner );
+			mInnerIndices = std::move( other.mInnerIndices );
+			mInnerSize = std::exchange( other.mInnerSize, 0 );
+			mIsEnd = std::exchange( other.mIsEnd, true );
+			mNumberElements = std::exchange( other.mNumberElements, 0 );
+			mOuter = std::move( other.mOuter );
+			mOuterChanged = std::exchange( other.mOuterChanged, true );
+			mOuterSize = std::exchange( other.mOuterSize, 0 );
+			mSource = std::exchange( other.mSource, NestedCombinationSource::Complement );
+		}
+
+		// Map the inner indices from {first} on to offsets of the N elements.
+		void _gatherInner(
+			size_t first )
+		{
+			const std::vector< SizeT >& source = ( NestedCombinationSource::Complement == mSource ) ? mComplement : mOuter;
+
+			for ( size_t index = first; index < mInnerSize; ++index )
+			{
+				mInner[ index ] = source[ mInnerIndices[ index ] ];
+			}
+		}
+
+		// Step the outer subset, rewriting the complement over the values from
+		// the old offset at the changed index through the larger of the old and
+		// new last offsets. Below that range both subsets agree, and above it
+		// neither holds an element, so those complement entries stay put.
+		bool _advanceOuter()
+		{
+			size_t index = mOuterSize;
+			for ( ; index-- && mOuter[ index ] == ( mNumberElements - mOuterSize + index ); );
+
+			if ( size_t( -1 ) == index )
+			{
+				return false;
+			}
+
+			size_t changed = index;
+			size_t first = mOuter[ changed ];
+			size_t last = std::max( size_t( mOuter[ mOuterSize - 1 ] ), first + mOuterSize - changed );
+
+			for ( mOuter[ index ]++; ++index < mOuterSize;
+				mOuter[ index ] = SizeT( mOuter[ index - 1 ] + 1 ) );
+
+			// The elements of the complement below {first} number first - changed.
+			size_t slot = first - changed;
+
+			for ( size_t element = first, next = changed; element <= last; ++element )
+			{
+				if ( ( next < mOuterSize ) and ( mOuter[ next ] == element ) )
+				{
+					++next;
+				}
+				else
+				{
+					mComplement[ slot++ ] = SizeT( element );
+				}
+			}
+
+			return true;
+		}
+
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using difference_type   = std::ptrdiff_t;
+		using value_type        = const std::vector< SizeT >;
+		using pointer           = const std::vector< SizeT >*;
+		using reference         = const std::vector< SizeT >&;
+
+		/**
+		 * Default constructor.
+		 */
+		const_iterator()
+		{
+			mInnerSize = 0;
+			mIsEnd = true;
+			mNumberElements = 0;
+			mOuterChanged = true;
+			mOuterSize = 0;
+			mSource = NestedCombinationSource::Complement;
+		}
+
+		/**
+		 * Move constructor.
+		 * @param other R-Value to the iterator to move.
+		 */
+		const_iterator(
+			const_iterator&& other )
+		{
+			_moveAssign( std::move( other ) );
+		}
+
+		/**
+		 * Copy constructor.
+		 * @param other Const reference to the iterator to copy.
+		 */
+		const_iterator(
+			const const_iterator& other )
+		{
+			_copyAssign( other );
+		}
+
+		/**
+		 * Move assignment.
+		 * @param other R-Value to the iterator to move.
+		 * @return Reference to this iterator instance.
+		 */
+		const_iterator& operator=(
+			const_iterator&& other )
+		{
+			if ( this != &other )
+			{
+				_moveAssign( std::move( other ) );
+			}
+
+			return *this;
+		}
+
+		/**
+		 * Copy assignment.
+		 * @param other Const reference to the iterator to copy.
+		 * @return Reference to this iterator instance.
+		 */
+		const_iterator& operator=(
+			const const_iterator& other )
+		{
+			if ( this != &other )
+			{
+				_copyAssign( other );
+			}
+
+			return *this;
+		}
+
+		/**
+		 * Equality operator.
+		 * Comparing against an end iterator only tests the end flags.
+		 * @param other Const reference to the iterator to compare against.
+		 * @return Return true if {@param other} compares equal to this iterator instance.
+		 */
+		bool operator==(
+			const const_iterator& other ) const
+		{
+			bool sameEnumeration = ( mNumberElements == other.mNumberElements )
+				and ( mOuterSize == other.mOuterSize )
+				and ( mInnerSize == other.mInnerSize )
+				and ( mSource == other.mSource );
+
+			if ( mIsEnd or other.mIsEnd )
+			{
+				return ( mIsEnd == other.mIsEnd ) and sameEnumeration;
+			}
+
+			return sameEnumeration
+				and std::equal( mInnerIndices.rbegin(), mInnerIndices.rend(), other.mInnerIndices.rbegin() )
+				and std::equal( mOuter.rbegin(), mOuter.rend(), other.mOuter.rbegin() );
+		}
+
+		/**
+		 * Inequality operator.
+		 * @param other Const reference to the iterator to compare against.
+		 * @return Return true if {@param other} compares not equal to this iterator instance.
+		 */
+		bool operator!=(
+			const const_iterator& other ) const
+		{
+			return not this->operator==( other );
+		}
+
+		/**
+		 * Member redirect.
+		 * @return Const pointer to the offsets of the inner subset.
+		 */
+		pointer operator->() const
+		{
+			return &mInner;
+		}
+
+		/**
+		 * Dereference operator.
+		 * @return Const reference to the offsets of the inner subset.
+		 */
+		reference operator*() const
+		{
+			return mInner;
+		}
+
+		/**
+		 * The elements left out of the outer subset, kept in step with it.
+		 * @return Const reference to the N - K1 increasing offsets of the complement.
+		 */
+		const std::vector< SizeT >& complement() const
+		{
+			return mComplement;
+		}
+
+		/**
+		 * The indices of the inner subset into complement() or outer(), whichever it is chosen from.
+		 * @return Const reference to the K2 increasing indices of the inner subset.
+		 */
+		const std::vector< SizeT >& innerIndices() const
+		{
+			return mInnerIndices;
+		}
+
+		/**
+		 * The outer subset.
+		 * @return Const reference to the K1 increasing offsets of the outer subset.
+		 */
+		const std::vector< SizeT >& outer() const
+		{
+			return mOuter;
+		}
+
+		/**
+		 * Whether the last increment stepped the outer subset, as it does when the inner
+		 * subsets wrap around, for callers holding work per outer subset. True initially.
+		 * @return True if the outer subset changed.
+		 */
+		bool outerChanged() const
+		{
+			return mOuterChanged;
+		}
+
+		/**
+		 * Post-increment operator.
+		 * @return iterator to the prior enumeration.
+		 */
+		const_iterator operator++( int )
+		{
+			const_iterator previous( *this );
+			this->operator++();
+			return previous;
+		}
+
+		/**
+		 * Pre-increment operator.
+		 * Steps to the next inner subset in place, and once the inner subsets
+		 * are exhausted, to the next outer subset and its first inner subset.
+		 * @return Reference to this iterator instance.
+		 */
+		const_iterator& operator++()
+		{
+			if ( mIsEnd )
+			{
+				return *this;
+			}
+
+			size_t sourceSize = _sourceSize( mNumberElements, mOuterSize, mSource );
+			size_t index = mInnerSize;
+			for ( ; index-- && mInnerIndices[ index ] == ( sourceSize - mInnerSize + index ); );
+
+			if ( size_t( -1 ) != index )
+			{
+				size_t changed = index;
+
+				for ( mInnerIndices[ index ]++; ++index < mInnerSize;
+					mInnerIndices[ index ] = SizeT( mInnerIndices[ index - 1 ] + 1 ) );
+
+				mOuterChanged = false;
+				_gatherInner( changed );
+			}
+			else if ( _advanceOuter() )
+			{
+				for ( index = 0; index < mInnerSize; mInnerIndices[ index ] = SizeT( index ), ++index );
+
+				mOuterChanged = true;
+				_gatherInner( 0 );
+			}
+			else
+			{
+				mIsEnd = true;
+			}
+
+			return *this;
+		}
+
+		/**
+		 * Swap this iterator with another.
+		 * @param other Reference to the iterator to swap with.
+		 */
+		void swap(
+			const_iterator& other )
+		{
+			std::swap( mComplement, other.mComplement );
+			std::swap( mInner, other.mInner );
+			std::swap( mInnerIndices, other.mInnerIndices );
+			std::swap( mInnerSize, other.mInnerSize );
+			std::swap( mIsEnd, other.mIsEnd );
+			std::swap( mNumberElements, other.mNumberElements );
+			std::swap( mOuter, other.mOuter );
+			std::swap( mOuterChanged, other.mOuterChanged );
+			std::swap( mOuterSize, other.mOuterSize );
+			std::swap( mSource, other.mSource );
+		}
+	};
+
+	/**
+	 * Default constructor.
+	 * @param numberElements Number of elements to choose from. [default: 0]
+	 * @param outerSize Number of elements to choose for the outer subset. [default: 0]
+	 * @param innerSize Number of elements to choose for the inner subset. [default: 0]
+	 * @param source The elements the inner subset is chosen from. [default: Complement]
+	 * @throw std::invalid_argument if the offsets of {@param numberElements} can't be represented by SizeT.
+	 */
+	NestedCombination(
+		size_t numberElements = 0,
+		size_t outerSize = 0,
+		size_t innerSize = 0,
+		NestedCombinationSource source = NestedCombinationSource::Complement )
+	{
+		if ( ( 0 < numberElements ) and ( std::numeric_limits< SizeT >::max() < numberElements - 1 ) )
+		{
+			throw std::invalid_argument( "numberElements exceeds the range of SizeT" );
+		}
+
+		mInnerSize = innerSize;
+		mNumberElements = numberElements;
+		mOuterSize = outerSize;
+		mSource = source;
+	}
+
+	/**
+	 * Move constructor.
+	 * @param other R-Value to the NestedCombination to move.
+	 */
+	NestedCombination(
+		NestedCombination&& other )
+	{
+		_moveAssign( std::move( other ) );
+	}
+
+	/**
+	 * Copy constructor.
+	 * @param other Const reference to the NestedCombination to copy.
+	 */
+	NestedCombination(
+		const NestedCombination& other )
+	{
+		_copyAssign( other );
+	}
+
+	/**
+	 * Beginning iterator.
+	 * @return Iterator to the beginning of the enumeration.
+	 */
+	const_iterator begin() const
+	{
+		return const_iterator( false, mNumberElements, mOuterSize, mInnerSize, mSource, 0 );
+	}
+
+	/**
+	 * End iterator.
+	 * @return Iterator to the end of the enumeration.
+	 */
+	const_iterator end() const
+	{
+		return const_iterator( true, mNumberElements, mOuterSize, mInnerSize, mSource, 0 );
+	}
+
+	/**
+	 * The number of elements to choose for the inner subset.
+	 * @return The inner subset size.
+	 */
+	size_t innerSize() const
+	{
+		return mInnerSize;
+	}
+
+	/**
+	 * The number of elements.
+	 * @return The number of elements.
+	 */
+	size_t numberElements() const
+	{
+		return mNumberElements;
+	}
+
+	/**
+	 * Move assignment operator.
+	 * @param other R-Value to the NestedCombination object to move to this instance.
+	 * @return Reference to this NestedCombination object is returned.
+	 */
+	NestedCombination& operator=(
+		NestedCombination&& other )
+	{
+		if ( this != &other )
+		{
+			_moveAssign( std::move( other ) );
+		}
+
+		return *this;
+	}
+
+	/**
+	 * Copy assignment operator.
+	 * @param other Const reference to the NestedCombination object to copy to this instance.
+	 * @return Reference to this NestedCombination object is returned.
+	 */
+	NestedCombination& operator=(
+		const NestedCombination& other )
+	{
+		if ( this != &other )
+		{
+			_copyAssign( other );
+		}
+
+		return *this;
+	}
+
+	/**
+	 * The number of elements to choose for the outer subset.
+	 * @return The outer subset size.
+	 */
+	size_t outerSize() const
+	{
+		return mOuterSize;
+	}
+
+	/**
+	 * The number of pairs of an outer and an inner subset, N choose K1
+	 * times either N - K1 choose K2 or K1 choose K2.
+	 * @return The number of pairs in the enumeration.
+	 * @throw std::overflow_error if the number of pairs doesn't fit in a size_t.
+	 */
+	size_t size() const
+	{
+		return _size( mNumberElements, mOuterSize, mInnerSize, mSource );
+	}
+
+	/**
+	 * A contiguous sub-range of the enumeration.
+	 * @param firstRank Rank of the first pair of the slice.
+	 * @param count Number of pairs in the slice.
+	 * @return Slice over the pairs of rank [firstRank, firstRank + count).
+	 * @throw std::out_of_range if the slice extends past the end of the enumeration.
+	 * @throw std::overflow_error if the number of pairs doesn't fit in a size_t.
+	 */
+	Slice< const_iterator > slice(
+		size_t firstRank,
+		size_t count ) const
+	{
+		size_t total = size();
+
+		if ( ( total < firstRank ) or ( total - firstRank < count ) )
+		{
+			throw std::out_of_range( "slice is outside of the enumeration" );
+		}
+
+		return Slice< const_iterator >(
+			const_iterator( total == firstRank, mNumberElements, mOuterSize, mInnerSize, mSource, firstRank ),
+			const_iterator( total == firstRank + count, mNumberElements, mOuterSize, mInnerSize, mSource,
+				firstRank + count ),
+			firstRank, count );
+	}
+
+	/**
+	 * The elements the inner subset is chosen from.
+	 * @return The source of the inner subset.
+	 */
+	NestedCombinationSource source() const
+	{
+		return mSource;
+	}
+};
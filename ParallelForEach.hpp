@@ -0,0 +1,340 @@
+/**
+ * Copyright ©2021-2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "CombinationStatistics.hpp"
+
+/**
+ * Class for a half-open range of ranks, [first, last), owned by
+ * one worker of parallelForEach. The owner takes small blocks from the
+ * front of the range, while idle workers steal the back half of it.
+ */
+class StealableRange
+{
+private:
+	std::mutex mMutex;
+	size_t mFirstRank;
+	size_t mLastRank;
+
+public:
+	/**
+	 * Default constructor, an empty range.
+	 */
+	StealableRange()
+	{
+		mFirstRank = 0;
+		mLastRank = 0;
+	}
+
+	StealableRange( const StealableRange& ) = delete;
+	StealableRange& operator=( const StealableRange& ) = delete;
+
+	/**
+	 * Replace the range.
+	 * @param firstRank First rank of the range.
+	 * @param lastRank One past the last rank of the range.
+	 */
+	void assign(
+		size_t firstRank,
+		size_t lastRank )
+	{
+		std::lock_guard< std::mutex > lock( mMutex );
+		mFirstRank = firstRank;
+		mLastRank = lastRank;
+	}
+
+	/**
+	 * The number of ranks left in the range.
+	 * @return The number of ranks not yet taken or stolen.
+	 */
+	size_t remaining()
+	{
+		std::lock_guard< std::mutex > lock( mMutex );
+		return mLastRank - mFirstRank;
+	}
+
+	/**
+	 * Steal the back half of the range, rounding up.
+	 * @param firstRank Reference to write the first stolen rank to.
+	 * @param lastRank Reference to write one past the last stolen rank to.
+	 * @return True if any ranks were stolen.
+	 */
+	bool steal(
+		size_t& firstRank,
+		size_t& lastRank )
+	{
+		std::lock_guard< std::mutex > lock( mMutex );
+		size_t count = mLastRank - mFirstRank;
+
+		if ( 0 == count )
+		{
+			return false;
+		}
+
+		lastRank = mLastRank;
+		firstRank = mLastRank - ( count - count / 2 );
+		mLastRank = firstRank;
+		return true;
+	}
+
+	/**
+	 * Take a block from the front of the range.
+	 * @param maximum The largest number of ranks to take.
+	 * @param firstRank Reference to write the first taken rank to.
+	 * @param lastRank Reference to write one past the last taken rank to.
+	 * @return True if any ranks were taken.
+	 */
+	bool take(
+		size_t maximum,
+		size_t& firstRank,
+		size_t& lastRank )
+	{
+		std::lock_guard< std::mutex > lock( mMutex );
+
+		if ( mFirstRank == mLastRank )
+		{
+			return false;
+		}
+
+		firstRank = mFirstRank;
+		lastRank = mFirstRank + std::min( maximum, mLastRank - mFirstRank );
+		mFirstRank = lastRank;
+		return true;
+	}
+};
+
+/**
+ * The work done by one thread of parallelForEach, for watching the
+ * throughput of each thread and how evenly the work was spread.
+ */
+struct ParallelWorkerStatistics
+{
+	// Blocks taken from the thread's own range.
+	uint64_t blocks = 0;
+
+	// The iterator counters of the thread over the call, which are only
+	// counted when COMBINATION_ENABLE_STATISTICS is defined.
+	CombinationStatistics combination;
+
+	// Wall clock time the thread spent in the call.
+	double seconds = 0;
+
+	// Ranges stolen from other threads.
+	uint64_t steals = 0;
+
+	// Subsets the function was called with.
+	uint64_t subsets = 0;
+
+	/**
+	 * The rate at which the thread visited subsets.
+	 * @return Subsets per second, or 0 if no time was measured.
+	 */
+	double subsetsPerSecond() const
+	{
+		return ( 0 < seconds ) ? double( subsets ) / seconds : 0;
+	}
+};
+
+/**
+ * Call a function on every subset of an enumeration using a pool of threads.
+ * The enumeration is first split into one contiguous rank range per thread.
+ * Each thread walks its own range with a single iterator, and once its range
+ * runs dry it steals the back half of the busiest remaining range, so uneven
+ * per-subset work doesn't leave threads idle.
+ *
+ * Any enumeration providing size() and slice( firstRank, count ), such as
+ * Combination, may be used; it remains the single source of the ordering.
+ * The function is shared by all of the threads and must be safe to call
+ * concurrently. If it throws, the remaining work is abandoned and the first
+ * exception is rethrown once all of the threads have stopped.
+ *
+ * As an example of use:
+ *     std::atomic< size_t > count( 0 );
+ *     parallelForEach( Combination( 60, 8 ), [ & ]( const std::vector< size_t >& subset ) {
+ *         count += isInteresting( subset ); } );
+ *
+ * @param combination Const reference to the enumeration to visit.
+ * @param function The function to call with each subset.
+ * @param threads Number of threads to use, including the calling thread. [default: 0, hardware concurrency]
+ * @param grainSize Number of subsets a thread takes from its own range at a time. [default: 0, automatic]
+ * @param statistics Pointer to a vector to write the work of each thread to, in thread order, or nullptr. [default: nullptr]
+ * @throw std::overflow_error if the number of subsets doesn't fit in a size_t.
+ * @throw std::system_error if a thread couldn't be started, once the started threads have stopped.
+ */
+template < typename CombinationT, typename Function >
+void parallelForEach(
+	const CombinationT& combination,
+	Function&& function,
+	size_t threads = 0,
+	size_t grainSize = 0,
+	std::vector< ParallelWorkerStatistics >* statistics = nullptr )
+{
+	size_t total = combination.size();
+
+	if ( 0 == threads )
+	{
+		threads = std::max< size_t >( 1, std::thread::hardware_concurrency() );
+	}
+
+	threads = std::max< size_t >( 1, std::min( threads, total ) );
+
+	if ( 0 == grainSize )
+	{
+		grainSize = std::min< size_t >( 1024, 1 + total / ( threads * 1024 ) );
+	}
+
+	std::unique_ptr< StealableRange[] > ranges( new StealableRange[ threads ] );
+	size_t quotient = total / threads;
+	size_t remainder = total % threads;
+
+	for ( size_t thread = 0, firstRank = 0; thread < threads; ++thread )
+	{
+		size_t count = quotient + ( thread < remainder );
+		ranges[ thread ].assign( firstRank, firstRank + count );
+		firstRank += count;
+	}
+
+	std::atomic< bool > stop( false );
+	std::exception_ptr exception;
+	std::mutex exceptionMutex;
+	std::vector< ParallelWorkerStatistics > workers( statistics ? threads : 0 );
+
+	auto worker = [ & ]( size_t self )
+	{
+		// Each thread only counts its own work, which is written out once it stops.
+		ParallelWorkerStatistics work;
+		const CombinationStatistics before = threadCombinationStatistics();
+		const auto start = std::chrono::steady_clock::now();
+
+		try
+		{
+			typename CombinationT::const_iterator iterator;
+			size_t iteratorRank = total;
+			size_t firstRank;
+			size_t lastRank;
+
+			while ( not stop.load( std::memory_order_relaxed ) )
+			{
+				if ( not ranges[ self ].take( grainSize, firstRank, lastRank ) )
+				{
+					// Steal from whichever range has the most left, if any.
+					size_t victim = self;
+					size_t mostRemaining = 0;
+
+					for ( size_t other = 0; other < threads; ++other )
+					{
+						size_t remaining = ( other == self ) ? 0 : ranges[ other ].remaining();
+
+						if ( mostRemaining < remaining )
+						{
+							victim = other;
+							mostRemaining = remaining;
+						}
+					}
+
+					if ( victim == self )
+					{
+						break;
+					}
+
+					if ( ranges[ victim ].steal( firstRank, lastRank ) )
+					{
+						ranges[ self ].assign( firstRank, lastRank );
+						++work.steals;
+					}
+
+					continue;
+				}
+
+				if ( iteratorRank != firstRank )
+				{
+					iterator = combination.slice( firstRank, 0 ).begin();
+				}
+
+				size_t rank = firstRank;
+
+				for ( ; ( rank < lastRank ) and not stop.load( std::memory_order_relaxed ); ++rank, ++iterator )
+				{
+					function( *iterator );
+				}
+
+				++work.blocks;
+				work.subsets += rank - firstRank;
+
+				iteratorRank = lastRank;
+			}
+		}
+		catch ( ... )
+		{
+			std::lock_guard< std::mutex > lock( exceptionMutex );
+
+			if ( not exception )
+			{
+				exception = std::current_exception();
+			}
+
+			stop = true;
+		}
+
+		if ( statistics )
+		{
+			work.combination = threadCombinationStatistics() - before;
+			work.seconds = std::chrono::duration< double >( std::chrono::steady_clock::now() - start ).count();
+			workers[ self ] = work;
+		}
+	};
+
+	std::vector< std::thread > pool;
+	pool.reserve( threads - 1 );
+
+	try
+	{
+		for ( size_t thread = 1; thread < threads; ++thread )
+		{
+			pool.emplace_back( worker, thread );
+		}
+	}
+	catch ( ... )
+	{
+		// Joinable threads mustn't be destroyed, so stop the ones that started.
+		stop = true;
+
+		for ( auto& thread : pool )
+		{
+			thread.join();
+		}
+
+		throw;
+	}
+
+	worker( 0 );
+
+	for ( auto& thread : pool )
+	{
+		thread.join();
+	}
+
+	if ( statistics )
+	{
+		*statistics = std::move( workers );
+	}
+
+	if ( exception )
+	{
+		std::rethrow_exception( exception );
+	}
+}
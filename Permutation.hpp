@@ -0,0 +1,543 @@
+/**
+ * Copyright ©2021-2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "BinomialCoefficient.hpp"
+#include "Slice.hpp"
+
+/**
+ * Class for enumerating over the K-permutations of a collection, the ordered
+ * selections of K of the N elements, of which there are N! / ( N - K )!.
+ * Like Combination, each selection is a collection of offsets into the
+ * original collection, but in the order selected rather than increasing.
+ *
+ * As an example of use:
+ *     std::vector< char > characters { 'a', 'b', 'c', 'd' };
+ *     Permutation<> permutation( characters.size(), 2 );
+ *     // Output: ab ac ad ba bc bd ca cb cd da db dc
+ *     for ( const auto& selection : permutation ) {
+ *         std::cout << characters[ selection[ 0 ] ] << characters[ selection[ 1 ] ] << " "; }
+ *
+ * The selections are enumerated in lexicographic order, starting from
+ * [ 0, 1, ..., K - 1 ] and ending at [ N - 1, N - 2, ..., N - K ]. The same
+ * rules for an empty enumeration apply as for Combination. size(), at(),
+ * rank() and slice() use the factorial number system, so the enumeration
+ * can also be split across threads with parallelForEach.
+ *
+ * Note:
+ *   - Requires C++14 and above.
+ */
+template < typename SizeT = size_t >
+class Permutation
+{
+	static_assert( std::is_integral< SizeT >::value and std::is_unsigned< SizeT >::value,
+		"SizeT must be an unsigned integral type" );
+
+private:
+	size_t mNumberElements;
+	size_t mSubsetSize;
+
+	void _copyAssign(
+		const Permutation& other )
+	{
+		mNumberElements = other.mNumberElements;
+		mSubsetSize = other.mSubsetSize;
+	}
+
+	void _moveAssign(
+		Permutation&& other )
+	{
+		mNumberElements = std::exchange( other.mNumberElements, 0 );
+		mSubsetSize = std::exchange( other.mSubsetSize, 0 );
+	}
+
+	static size_t _size(
+		size_t numberElements,
+		size_t subsetSize )
+	{
+		size_t count = 0;
+
+		if ( ( 0 < subsetSize ) and ( subsetSize <= numberElements )
+			and not fallingFactorial( numberElements, subsetSize, count ) )
+		{
+			throw std::overflow_error( "number of selections exceeds the range of size_t" );
+		}
+
+		return count;
+	}
+
+	static void _unrank(
+		size_t numberElements,
+		size_t subsetSize,
+		size_t rank,
+		SizeT* enumeration,
+		unsigned char* used )
+	{
+		std::fill_n( used, numberElements, 0 );
+
+		for ( size_t index = 0; index < subsetSize; ++index )
+		{
+			// Each digit selects the next offset from among those still unused.
+			size_t block;
+			fallingFactorial( numberElements - 1 - index, subsetSize - 1 - index, block );
+			size_t digit = rank / block;
+			rank %= block;
+
+			size_t element = 0;
+			for ( ; used[ element ] or digit--; ++element );
+
+			enumeration[ index ] = SizeT( element );
+			used[ element ] = 1;
+		}
+	}
+
+public:
+	/**
+	 * Iterator class for enumerating over the
+	 * K-permutations of a collection.
+	 */
+	class const_iterator
+	{
+	private:
+		friend class Permutation;
+
+		bool mIsEnd;
+		size_t mNumberElements;
+		size_t mSubsetSize;
+		std::vector< SizeT > mEnumeration;
+		std::vector< unsigned char > mUsed;
+
+		const_iterator(
+			bool end,
+			size_t numberElements,
+			size_t subsetSize,
+			size_t rank )
+		{
+			mIsEnd = end;
+			mNumberElements = numberElements;
+			mSubsetSize = subsetSize;
+
+			if ( not mIsEnd and ( 0 < mSubsetSize ) and ( mSubsetSize <= mNumberElements ) )
+			{
+				mEnumeration.resize( mSubsetSize );
+				mUsed.resize( mNumberElements );
+				_unrank( mNumberElements, mSubsetSize, rank, mEnumeration.data(), mUsed.data() );
+			}
+			else
+			{
+				mIsEnd = true;
+			}
+		}
+
+		void _copyAssign(
+			const const_iterator& other )
+		{
+			mIsEnd = other.mIsEnd;
+			mNumberElements = other.mNumberElements;
+			mSubsetSize = other.mSubsetSize;
+			mEnumeration = other.mEnumeration;
+			mUsed = other.mUsed;
+		}
+
+		void _moveAssign(
+			const_iterator&& other )
+		{
+			mIsEnd = std::exchange( other.mIsEnd, true );
+			mNumberElements = std::exchange( other.mNumberElements, 0 );
+			mSubsetSize = std::exchange( other.mSubsetSize, 0 );
+			mEnumeration = std::move( other.mEnumeration );
+			mUsed = std::move( other.mUsed );
+		}
+
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using difference_type   = std::ptrdiff_t;
+		using value_type        = const std::vector< SizeT >;
+		using pointer           = const std::vector< SizeT >*;
+		using reference         = const std::vector< SizeT >&;
+
+		/**
+		 * Default constructor.
+		 */
+		const_iterator()
+		{
+			mIsEnd = true;
+			mNumberElements = 0;
+			mSubsetSize = 0;
+		}
+
+		/**
+		 * Move constructor.
+		 * @param other R-Value to the iterator to move.
+		 */
+		const_iterator(
+			const_iterator&& other )
+		{
+			_moveAssign( std::move( other ) );
+		}
+
+		/**
+		 * Copy constructor.
+		 * @param other Const reference to the iterator to copy.
+		 */
+		const_iterator(
+			const const_iterator& other )
+		{
+			_copyAssign( other );
+		}
+
+		/**
+		 * Move assignment.
+		 * @param other R-Value to the iterator to move.
+		 * @return Reference to this iterator instance.
+		 */
+		const_iterator& operator=(
+			const_iterator&& other )
+		{
+			if ( this != &other )
+			{
+				_moveAssign( std::move( other ) );
+			}
+
+			return *this;
+		}
+
+		/**
+		 * Copy assignment.
+		 * @param other Const reference to the iterator to copy.
+		 * @return Reference to this iterator instance.
+		 */
+		const_iterator& operator=(
+			const const_iterator& other )
+		{
+			if ( this != &other )
+			{
+				_copyAssign( other );
+			}
+
+			return *this;
+		}
+
+		/**
+		 * Equality operator.
+		 * Comparing against an end iterator only tests the end flags.
+		 * @param other Const reference to the iterator to compare against.
+		 * @return Return true if {@param other} compares equal to this iterator instance.
+		 */
+		bool operator==(
+			const const_iterator& other ) const
+		{
+			if ( mIsEnd or other.mIsEnd )
+			{
+				return ( mIsEnd == other.mIsEnd )
+					and ( mNumberElements == other.mNumberElements )
+					and ( mSubsetSize == other.mSubsetSize );
+			}
+
+			return ( mNumberElements == other.mNumberElements )
+				and ( mSubsetSize == other.mSubsetSize )
+				and std::equal( mEnumeration.rbegin(), mEnumeration.rend(), other.mEnumeration.rbegin() );
+		}
+
+		/**
+		 * Inequality operator.
+		 * @param other Const reference to the iterator to compare against.
+		 * @return Return true if {@param other} compares not equal to this iterator instance.
+		 */
+		bool operator!=(
+			const const_iterator& other ) const
+		{
+			return not this->operator==( other );
+		}
+
+		/**
+		 * Member redirect.
+		 * @return Const pointer to the enumeration.
+		 */
+		pointer operator->() const
+		{
+			return &mEnumeration;
+		}
+
+		/**
+		 * Dereference operator.
+		 * @return Const reference to the enumeration.
+		 */
+		reference operator*() const
+		{
+			return mEnumeration;
+		}
+
+		/**
+		 * Post-increment operator.
+		 * @return iterator to the prior enumeration.
+		 */
+		const_iterator operator++( int )
+		{
+			const_iterator previous( *this );
+			this->operator++();
+			return previous;
+		}
+
+		/**
+		 * Pre-increment operator.
+		 * Releases offsets from the back until one can be replaced by a larger
+		 * unused offset, then fills the rest with the smallest unused offsets.
+		 * @return Reference to this iterator instance.
+		 */
+		const_iterator& operator++()
+		{
+			for ( size_t index = mEnumeration.size(); index--; )
+			{
+				size_t element = mEnumeration[ index ];
+				mUsed[ element ] = 0;
+
+				for ( ++element; ( element < mNumberElements ) and mUsed[ element ]; ++element );
+
+				if ( element < mNumberElements )
+				{
+					mEnumeration[ index ] = SizeT( element );
+					mUsed[ element ] = 1;
+
+					for ( element = 0; ++index < mSubsetSize; ++element )
+					{
+						for ( ; mUsed[ element ]; ++element );
+
+						mEnumeration[ index ] = SizeT( element );
+						mUsed[ element ] = 1;
+					}
+
+					return *this;
+				}
+			}
+
+			mIsEnd = true;
+			return *this;
+		}
+
+		/**
+		 * Swap this iterator with another.
+		 * @param other Reference to the iterator to swap with.
+		 */
+		void swap(
+			const_iterator& other )
+		{
+			std::swap( mIsEnd, other.mIsEnd );
+			std::swap( mNumberElements, other.mNumberElements );
+			std::swap( mSubsetSize, other.mSubsetSize );
+			std::swap( mEnumeration, other.mEnumeration );
+			std::swap( mUsed, other.mUsed );
+		}
+	};
+
+	/**
+	 * Default constructor.
+	 * @param numberElements Number of elements to choose from. [default: 0]
+	 * @param subsetSize Numer of element to choose. [default: 0]
+	 * @throw std::invalid_argument if the offsets of {@param numberElements} can't be represented by SizeT.
+	 */
+	Permutation(
+		size_t numberElements = 0,
+		size_t subsetSize = 0 )
+	{
+		if ( ( 0 < numberElements ) and ( std::numeric_limits< SizeT >::max() < numberElements - 1 ) )
+		{
+			throw std::invalid_argument( "numberElements exceeds the range of SizeT" );
+		}
+
+		mNumberElements = numberElements;
+		mSubsetSize = subsetSize;
+	}
+
+	/**
+	 * Move constructor.
+	 * @param other R-Value to the Permutation to move.
+	 */
+	Permutation(
+		Permutation&& other )
+	{
+		_moveAssign( std::move( other ) );
+	}
+
+	/**
+	 * Copy constructor.
+	 * @param other Const reference to the Permutation to copy.
+	 */
+	Permutation(
+		const Permutation& other )
+	{
+		_copyAssign( other );
+	}
+
+	/**
+	 * The selection at the given rank of the enumeration.
+	 * @param rank Lexicographic rank of the selection, starting from 0.
+	 * @return Vector of offsets of the selection.
+	 * @throw std::out_of_range if {@param rank} isn't less than size().
+	 * @throw std::overflow_error if the number of selections doesn't fit in a size_t.
+	 */
+	std::vector< SizeT > at(
+		size_t rank ) const
+	{
+		if ( size() <= rank )
+		{
+			throw std::out_of_range( "rank is outside of the enumeration" );
+		}
+
+		std::vector< SizeT > selection( mSubsetSize );
+		std::vector< unsigned char > used( mNumberElements );
+		_unrank( mNumberElements, mSubsetSize, rank, selection.data(), used.data() );
+		return selection;
+	}
+
+	/**
+	 * Beginning iterator.
+	 * @return Iterator to the beginning of the permutation enumeration.
+	 */
+	const_iterator begin() const
+	{
+		return const_iterator( false, mNumberElements, mSubsetSize, 0 );
+	}
+
+	/**
+	 * End iterator.
+	 * @return Iterator to the end of the permutation enumeration.
+	 */
+	const_iterator end() const
+	{
+		return const_iterator( true, mNumberElements, mSubsetSize, 0 );
+	}
+
+	/**
+	 * The number of elements.
+	 * @return The number of elements.
+	 */
+	size_t numberElements() const
+	{
+		return mNumberElements;
+	}
+
+	/**
+	 * Move assignment operator.
+	 * @param other R-Value to the Permutation object to move to this instance.
+	 * @return Reference to this Permutation object is returned.
+	 */
+	Permutation& operator=(
+		Permutation&& other )
+	{
+		if ( this != &other )
+		{
+			_moveAssign( std::move( other ) );
+		}
+
+		return *this;
+	}
+
+	/**
+	 * Copy assignment operator.
+	 * @param other Const reference to the Permutation object to copy to this instance.
+	 * @return Reference to this Permutation object is returned.
+	 */
+	Permutation& operator=(
+		const Permutation& other )
+	{
+		if ( this != &other )
+		{
+			_copyAssign( other );
+		}
+
+		return *this;
+	}
+
+	/**
+	 * The rank of a selection within the enumeration.
+	 * @param selection Const reference to the K distinct offsets of the selection.
+	 * @return Lexicographic rank of {@param selection}, starting from 0.
+	 * @throw std::invalid_argument if {@param selection} isn't part of the enumeration.
+	 * @throw std::overflow_error if the number of selections doesn't fit in a size_t.
+	 */
+	size_t rank(
+		const std::vector< SizeT >& selection ) const
+	{
+		if ( ( 0 == size() ) or ( selection.size() != mSubsetSize ) )
+		{
+			throw std::invalid_argument( "selection isn't part of the enumeration" );
+		}
+
+		std::vector< unsigned char > used( mNumberElements );
+		size_t rank = 0;
+
+		for ( size_t index = 0; index < mSubsetSize; ++index )
+		{
+			size_t element = selection[ index ];
+
+			if ( ( mNumberElements <= element ) or used[ element ] )
+			{
+				throw std::invalid_argument( "selection isn't part of the enumeration" );
+			}
+
+			size_t block;
+			fallingFactorial( mNumberElements - 1 - index, mSubsetSize - 1 - index, block );
+			rank += block * size_t( std::count( used.begin(), used.begin() + element, 0 ) );
+			used[ element ] = 1;
+		}
+
+		return rank;
+	}
+
+	/**
+	 * The number of selections, N! / ( N - K )!.
+	 * @return The number of selections in the enumeration.
+	 * @throw std::overflow_error if the number of selections doesn't fit in a size_t.
+	 */
+	size_t size() const
+	{
+		return _size( mNumberElements, mSubsetSize );
+	}
+
+	/**
+	 * A contiguous sub-range of the enumeration.
+	 * @param firstRank Rank of the first selection of the slice.
+	 * @param count Number of selections in the slice.
+	 * @return Slice over the selections of rank [firstRank, firstRank + count).
+	 * @throw std::out_of_range if the slice extends past the end of the enumeration.
+	 * @throw std::overflow_error if the number of selections doesn't fit in a size_t.
+	 */
+	Slice< const_iterator > slice(
+		size_t firstRank,
+		size_t count ) const
+	{
+		size_t total = size();
+
+		if ( ( total < firstRank ) or ( total - firstRank < count ) )
+		{
+			throw std::out_of_range( "slice is outside of the enumeration" );
+		}
+
+		return Slice< const_iterator >(
+			const_iterator( total == firstRank, mNumberElements, mSubsetSize, firstRank ),
+			const_iterator( total == firstRank + count, mNumberElements, mSubsetSize, firstRank + count ),
+			firstRank, count );
+	}
+
+	/**
+	 * The number of elements to choose.
+	 * @return The subset size.
+	 */
+	size_t subsetSize() const
+	{
+		return mSubsetSize;
+	}
+};
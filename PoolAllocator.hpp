@@ -0,0 +1,277 @@
+/**
+ * Copyright ©2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <new>
+
+/**
+ * Class for the per thread free lists behind PoolAllocator. Blocks are
+ * grouped in power of two size classes from 16 bytes to MaximumBlockSize,
+ * and a released block is kept on the free list of the releasing thread,
+ * up to MaximumCachedBlocks per class, for the next allocation of its class.
+ * Larger blocks go straight to operator new.
+ *
+ * Note:
+ *   - Requires C++14 and above.
+ */
+class ThreadBlockPool
+{
+public:
+	/**
+	 * The largest block held on a free list, in bytes.
+	 */
+	static constexpr size_t MaximumBlockSize = size_t( 1 ) << 20;
+
+	/**
+	 * The largest number of free blocks kept per size class.
+	 */
+	static constexpr size_t MaximumCachedBlocks = 64;
+
+private:
+	static constexpr size_t _minimumBlockSize()
+	{
+		return 16;
+	}
+
+	// Size classes from 16 bytes up to MaximumBlockSize.
+	static constexpr size_t ClassCount = 17;
+
+	struct FreeBlock
+	{
+		FreeBlock* next;
+	};
+
+	size_t mCached[ ClassCount ];
+	FreeBlock* mFree[ ClassCount ];
+
+	// Set once the pool of the thread is destroyed, as a thread local object
+	// destroyed after it may still release memory from the pool. Being
+	// trivially destructible, the flag outlives the pool.
+	static bool& _destroyed()
+	{
+		static thread_local bool destroyed = false;
+		return destroyed;
+	}
+
+	static size_t _class(
+		size_t bytes )
+	{
+		size_t sizeClass = 0;
+		for ( size_t blockSize = _minimumBlockSize(); blockSize < bytes; blockSize <<= 1, ++sizeClass );
+		return sizeClass;
+	}
+
+	ThreadBlockPool()
+	{
+		for ( size_t sizeClass = 0; sizeClass < ClassCount; ++sizeClass )
+		{
+			mCached[ sizeClass ] = 0;
+			mFree[ sizeClass ] = nullptr;
+		}
+	}
+
+	~ThreadBlockPool()
+	{
+		for ( size_t sizeClass = 0; sizeClass < ClassCount; ++sizeClass )
+		{
+			while ( FreeBlock* block = mFree[ sizeClass ] )
+			{
+				mFree[ sizeClass ] = block->next;
+				::operator delete( block );
+			}
+		}
+
+		_destroyed() = true;
+	}
+
+	static ThreadBlockPool& _instance()
+	{
+		static thread_local ThreadBlockPool pool;
+		return pool;
+	}
+
+public:
+	ThreadBlockPool( const ThreadBlockPool& ) = delete;
+	ThreadBlockPool& operator=( const ThreadBlockPool& ) = delete;
+
+	/**
+	 * Allocate a block from the free lists of the calling thread.
+	 * @param bytes The size of the block.
+	 * @return Pointer to the block, aligned as by operator new.
+	 * @throw std::bad_alloc if the block couldn't be allocated.
+	 */
+	static void* allocate(
+		size_t bytes )
+	{
+		if ( ( MaximumBlockSize < bytes ) or _destroyed() )
+		{
+			return ::operator new( bytes );
+		}
+
+		ThreadBlockPool& pool = _instance();
+		size_t sizeClass = _class( bytes );
+
+		if ( FreeBlock* block = pool.mFree[ sizeClass ] )
+		{
+			pool.mFree[ sizeClass ] = block->next;
+			--pool.mCached[ sizeClass ];
+			return block;
+		}
+
+		return ::operator new( _minimumBlockSize() << sizeClass );
+	}
+
+	/**
+	 * Release a block to the free lists of the calling thread, which need
+	 * not be the thread that allocated it.
+	 * @param pointer Pointer to the block returned by allocate.
+	 * @param bytes The size the block was allocated with.
+	 */
+	static void deallocate(
+		void* pointer,
+		size_t bytes )
+	{
+		if ( ( MaximumBlockSize < bytes ) or _destroyed() )
+		{
+			::operator delete( pointer );
+			return;
+		}
+
+		ThreadBlockPool& pool = _instance();
+		size_t sizeClass = _class( bytes );
+
+		if ( MaximumCachedBlocks <= pool.mCached[ sizeClass ] )
+		{
+			::operator delete( pointer );
+			return;
+		}
+
+		FreeBlock* block = static_cast< FreeBlock* >( pointer );
+		block->next = pool.mFree[ sizeClass ];
+		pool.mFree[ sizeClass ] = block;
+		++pool.mCached[ sizeClass ];
+	}
+
+	/**
+	 * The number of free blocks the calling thread holds.
+	 * @return The number of blocks on the free lists of the calling thread.
+	 */
+	static size_t cachedBlocks()
+	{
+		if ( _destroyed() )
+		{
+			return 0;
+		}
+
+		size_t count = 0;
+
+		for ( size_t sizeClass = 0; sizeClass < ClassCount; ++sizeClass )
+		{
+			count += _instance().mCached[ sizeClass ];
+		}
+
+		return count;
+	}
+};
+
+/**
+ * Allocator drawing from a free list per thread, for containers that
+ * repeatedly allocate and release buffers of similar sizes, such as the
+ * enumeration buffers of Combination iterators for a large K.
+ *
+ * As an example of use:
+ *     BasicCombination< uint16_t, PoolAllocator< uint16_t > > combination( 1000, 300 );
+ *     for ( auto iterator = combination.begin(); iterator != combination.end(); ) {
+ *         auto previous = iterator++;
+ *         compare( *previous, *iterator ); }
+ *
+ * Note:
+ *   - Requires C++14 and above.
+ */
+template < typename T >
+class PoolAllocator
+{
+	static_assert( alignof( T ) <= alignof( std::max_align_t ), "T must not be over-aligned" );
+
+public:
+	using value_type = T;
+
+	template < typename U >
+	struct rebind
+	{
+		using other = PoolAllocator< U >;
+	};
+
+	/**
+	 * Default constructor.
+	 */
+	PoolAllocator() = default;
+
+	/**
+	 * Converting copy constructor.
+	 * @param other Const reference to the allocator of another type to copy.
+	 */
+	template < typename U >
+	PoolAllocator(
+		const PoolAllocator< U >& )
+	{
+	}
+
+	/**
+	 * Allocate storage from the pool of the calling thread.
+	 * @param count The number of elements to allocate storage for.
+	 * @return Pointer to the storage.
+	 * @throw std::bad_alloc if the storage couldn't be allocated.
+	 */
+	T* allocate(
+		size_t count )
+	{
+		if ( std::numeric_limits< size_t >::max() / sizeof( T ) < count )
+		{
+			throw std::bad_alloc();
+		}
+
+		return static_cast< T* >( ThreadBlockPool::allocate( count * sizeof( T ) ) );
+	}
+
+	/**
+	 * Release storage returned by allocate to the pool of the calling thread.
+	 * @param pointer Pointer to the storage to release.
+	 * @param count The number of elements the storage was allocated for.
+	 */
+	void deallocate(
+		T* pointer,
+		size_t count )
+	{
+		ThreadBlockPool::deallocate( pointer, count * sizeof( T ) );
+	}
+};
+
+/**
+ * Equality operator, all pool allocators are interchangeable.
+ * @return Return true.
+ */
+template < typename T, typename U >
+bool operator==(
+	const PoolAllocator< T >&,
+	const PoolAllocator< U >& )
+{
+	return true;
+}
+
+/**
+ * Inequality operator, all pool allocators are interchangeable.
+ * @return Return false.
+ */
+template < typename T, typename U >
+bool operator!=(
+	const PoolAllocator< T >&,
+	const PoolAllocator< U >& )
+{
+	return false;
+}
@@ -0,0 +1,600 @@
+/**
+ * Copyright ©2021-2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "BinomialCoefficient.hpp"
+#include "Combination.hpp"
+#include "Slice.hpp"
+
+/**
+ * Class for enumerating over the subsets of a collection of every size from
+ * minimumSubsetSize to maximumSubsetSize in a single pass, in banker's order:
+ * by increasing size, then lexicographically within each size, exactly as
+ * Combination( N, k ) would for each k in turn. The iterator's buffer only
+ * holds the current size, growing as the size does, so that a large N with
+ * a maximum size of N costs nothing until the large sizes are reached.
+ *
+ * As an example of use:
+ *     // Every non-empty subset of 10 elements.
+ *     for ( const auto& subset : PowerSetCombination<>( 10 ) ) {
+ *         process( subset ); }
+ *
+ *     // The subsets of 2 to 4 elements of 30.
+ *     PowerSetCombination<> combination( 30, 2, 4 );
+ *
+ * The empty subset is never part of the enumeration, matching Combination's
+ * rule for K = 0, and sizes beyond N are ignored. size(), at(), rank() and
+ * slice() follow the same rank order, so the enumeration works with
+ * parallelForEach, while const_iterator::nextBatch writes the subsets of
+ * one size at a time.
+ *
+ * Note:
+ *   - Requires C++14 and above.
+ */
+template < typename SizeT = size_t >
+class PowerSetCombination
+{
+	static_assert( std::is_integral< SizeT >::value and std::is_unsigned< SizeT >::value,
+		"SizeT must be an unsigned integral type" );
+
+private:
+	size_t mNumberElements;
+	size_t mMinimumSubsetSize;
+	size_t mMaximumSubsetSize;
+
+	void _copyAssign(
+		const PowerSetCombination& other )
+	{
+		mNumberElements = other.mNumberElements;
+		mMinimumSubsetSize = other.mMinimumSubsetSize;
+		mMaximumSubsetSize = other.mMaximumSubsetSize;
+	}
+
+	void _moveAssign(
+		PowerSetCombination&& other )
+	{
+		mNumberElements = std::exchange( other.mNumberElements, 0 );
+		mMinimumSubsetSize = std::exchange( other.mMinimumSubsetSize, 1 );
+		mMaximumSubsetSize = std::exchange( other.mMaximumSubsetSize, 0 );
+	}
+
+	static size_t _count(
+		size_t numberElements,
+		size_t subsetSize )
+	{
+		size_t count;
+
+		if ( not binomialCoefficient( numberElements, subsetSize, count ) )
+		{
+			throw std::overflow_error( "number of subsets exceeds the range of size_t" );
+		}
+
+		return count;
+	}
+
+public:
+	/**
+	 * Iterator class for enumerating over the subsets
+	 * of a collection over a range of sizes.
+	 */
+	class const_iterator
+	{
+	private:
+		friend class PowerSetCombination;
+
+		bool mIsEnd;
+		size_t mNumberElements;
+		size_t mMinimumSubsetSize;
+		size_t mMaximumSubsetSize;
+		std::vector< SizeT > mEnumeration;
+
+		const_iterator(
+			bool end,
+			const PowerSetCombination& combination,
+			size_t subsetSize,
+			size_t rank )
+		{
+			mIsEnd = end or ( combination.mMaximumSubsetSize < combination.mMinimumSubsetSize );
+			mNumberElements = combination.mNumberElements;
+			mMinimumSubsetSize = combination.mMinimumSubsetSize;
+			mMaximumSubsetSize = combination.mMaximumSubsetSize;
+
+			if ( not mIsEnd )
+			{
+				if ( 0 == rank )
+				{
+					mEnumeration.resize( subsetSize );
+					std::iota( mEnumeration.begin(), mEnumeration.end(), SizeT( 0 ) );
+				}
+				else
+				{
+					std::vector< SizeT > subset = BasicCombination< SizeT >( mNumberElements, subsetSize ).at( rank );
+					mEnumeration.assign( subset.begin(), subset.end() );
+				}
+			}
+		}
+
+		void _copyAssign(
+			const const_iterator& other )
+		{
+			mIsEnd = other.mIsEnd;
+			mNumberElements = other.mNumberElements;
+			mMinimumSubsetSize = other.mMinimumSubsetSize;
+			mMaximumSubsetSize = other.mMaximumSubsetSize;
+			mEnumeration = other.mEnumeration;
+		}
+
+		void _moveAssign(
+			const_iterator&& other )
+		{
+			mIsEnd = std::exchange( other.mIsEnd, true );
+			mNumberElements = std::exchange( other.mNumberElements, 0 );
+			mMinimumSubsetSize = std::exchange( other.mMinimumSubsetSize, 1 );
+			mMaximumSubsetSize = std::exchange( other.mMaximumSubsetSize, 0 );
+			mEnumeration = std::move( other.mEnumeration );
+		}
+
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using difference_type   = std::ptrdiff_t;
+		using value_type        = const std::vector< SizeT >;
+		using pointer           = const std::vector< SizeT >*;
+		using reference         = const std::vector< SizeT >&;
+
+		/**
+		 * Default constructor.
+		 */
+		const_iterator()
+		{
+			mIsEnd = true;
+			mNumberElements = 0;
+			mMinimumSubsetSize = 1;
+			mMaximumSubsetSize = 0;
+		}
+
+		/**
+		 * Move constructor.
+		 * @param other R-Value to the iterator to move.
+		 */
+		const_iterator(
+			const_iterator&& other )
+		{
+			_moveAssign( std::move( other ) );
+		}
+
+		/**
+		 * Copy constructor.
+		 * @param other Const reference to the iterator to copy.
+		 */
+		const_iterator(
+			const const_iterator& other )
+		{
+			_copyAssign( other );
+		}
+
+		/**
+		 * Move assignment.
+		 * @param other R-Value to the iterator to move.
+		 * @return Reference to this iterator instance.
+		 */
+		const_iterator& operator=(
+			const_iterator&& other )
+		{
+			if ( this != &other )
+			{
+				_moveAssign( std::move( other ) );
+			}
+
+			return *this;
+		}
+
+		/**
+		 * Copy assignment.
+		 * @param other Const reference to the iterator to copy.
+		 * @return Reference to this iterator instance.
+		 */
+		const_iterator& operator=(
+			const const_iterator& other )
+		{
+			if ( this != &other )
+			{
+				_copyAssign( other );
+			}
+
+			return *this;
+		}
+
+		/**
+		 * Equality operator.
+		 * Comparing against an end iterator only tests the end flags.
+		 * @param other Const reference to the iterator to compare against.
+		 * @return Return true if {@param other} compares equal to this iterator instance.
+		 */
+		bool operator==(
+			const const_iterator& other ) const
+		{
+			bool sameRange = ( mNumberElements == other.mNumberElements )
+				and ( mMinimumSubsetSize == other.mMinimumSubsetSize )
+				and ( mMaximumSubsetSize == other.mMaximumSubsetSize );
+
+			if ( mIsEnd or other.mIsEnd )
+			{
+				return ( mIsEnd == other.mIsEnd ) and sameRange;
+			}
+
+			return sameRange and ( mEnumeration.size() == other.mEnumeration.size() )
+				and std::equal( mEnumeration.rbegin(), mEnumeration.rend(), other.mEnumeration.rbegin() );
+		}
+
+		/**
+		 * Inequality operator.
+		 * @param other Const reference to the iterator to compare against.
+		 * @return Return true if {@param other} compares not equal to this iterator instance.
+		 */
+		bool operator!=(
+			const const_iterator& other ) const
+		{
+			return not this->operator==( other );
+		}
+
+		/**
+		 * Member redirect.
+		 * @return Const pointer to the enumeration.
+		 */
+		pointer operator->() const
+		{
+			return &mEnumeration;
+		}
+
+		/**
+		 * Dereference operator.
+		 * @return Const reference to the enumeration.
+		 */
+		reference operator*() const
+		{
+			return mEnumeration;
+		}
+
+		/**
+		 * Write the next subsets, all of the current size, into a caller
+		 * provided buffer and advance past them. A batch stops short at the
+		 * last subset of a size, so the size of every subset of the batch is
+		 * the size of the enumeration before the call.
+		 * @param out Pointer to a buffer of at least {@param maxSubsets} times the current subset size offsets.
+		 * @param maxSubsets The largest number of subsets to write.
+		 * @return The number of subsets written.
+		 */
+		size_t nextBatch(
+			SizeT* out,
+			size_t maxSubsets )
+		{
+			size_t count = 0;
+
+			if ( mIsEnd )
+			{
+				return count;
+			}
+
+			const size_t subsetSize = mEnumeration.size();
+
+			for ( ; ( count < maxSubsets ) and not mIsEnd and ( mEnumeration.size() == subsetSize ); ++count )
+			{
+				out = std::copy( mEnumeration.begin(), mEnumeration.end(), out );
+				this->operator++();
+			}
+
+			return count;
+		}
+
+		/**
+		 * Post-increment operator.
+		 * @return iterator to the prior enumeration.
+		 */
+		const_iterator operator++( int )
+		{
+			const_iterator previous( *this );
+			this->operator++();
+			return previous;
+		}
+
+		/**
+		 * Pre-increment operator.
+		 * After the last subset of a size, moves on to the first subset of
+		 * the next size, growing the buffer by one offset.
+		 * @return Reference to this iterator instance.
+		 */
+		const_iterator& operator++()
+		{
+			if ( mIsEnd )
+			{
+				return *this;
+			}
+
+			size_t subsetSize = mEnumeration.size();
+
+			for ( size_t index = subsetSize; index--; )
+			{
+				if ( mEnumeration[ index ] < mNumberElements - subsetSize + index )
+				{
+					for ( SizeT offset = mEnumeration[ index ] + 1; index < subsetSize;
+						mEnumeration[ index++ ] = offset++ );
+
+					return *this;
+				}
+			}
+
+			if ( subsetSize < mMaximumSubsetSize )
+			{
+				mEnumeration.resize( subsetSize + 1 );
+				std::iota( mEnumeration.begin(), mEnumeration.end(), SizeT( 0 ) );
+			}
+			else
+			{
+				mIsEnd = true;
+			}
+
+			return *this;
+		}
+
+		/**
+		 * Swap this iterator with another.
+		 * @param other Reference to the iterator to swap with.
+		 */
+		void swap(
+			const_iterator& other )
+		{
+			std::swap( mIsEnd, other.mIsEnd );
+			std::swap( mNumberElements, other.mNumberElements );
+			std::swap( mMinimumSubsetSize, other.mMinimumSubsetSize );
+			std::swap( mMaximumSubsetSize, other.mMaximumSubsetSize );
+			std::swap( mEnumeration, other.mEnumeration );
+		}
+	};
+
+	/**
+	 * Default constructor.
+	 * @param numberElements Number of elements to choose from. [default: 0]
+	 * @param minimumSubsetSize Smallest number of elements to choose, raised to 1. [default: 1]
+	 * @param maximumSubsetSize Largest number of elements to choose, lowered to {@param numberElements}. [default: {@param numberElements}]
+	 * @throw std::invalid_argument if the offsets of {@param numberElements} can't be represented by SizeT.
+	 */
+	PowerSetCombination(
+		size_t numberElements = 0,
+		size_t minimumSubsetSize = 1,
+		size_t maximumSubsetSize = std::numeric_limits< size_t >::max() )
+	{
+		if ( ( 0 < numberElements ) and ( std::numeric_limits< SizeT >::max() < numberElements - 1 ) )
+		{
+			throw std::invalid_argument( "numberElements exceeds the range of SizeT" );
+		}
+
+		mNumberElements = numberElements;
+		mMinimumSubsetSize = std::max< size_t >( 1, minimumSubsetSize );
+		mMaximumSubsetSize = std::min( numberElements, maximumSubsetSize );
+	}
+
+	/**
+	 * Move constructor.
+	 * @param other R-Value to the PowerSetCombination to move.
+	 */
+	PowerSetCombination(
+		PowerSetCombination&& other )
+	{
+		_moveAssign( std::move( other ) );
+	}
+
+	/**
+	 * Copy constructor.
+	 * @param other Const reference to the PowerSetCombination to copy.
+	 */
+	PowerSetCombination(
+		const PowerSetCombination& other )
+	{
+		_copyAssign( other );
+	}
+
+	/**
+	 * The subset at the given rank of the enumeration.
+	 * @param rank Rank of the subset in banker's order, starting from 0.
+	 * @return Vector of offsets of the subset.
+	 * @throw std::out_of_range if {@param rank} isn't less than size().
+	 * @throw std::overflow_error if the number of subsets doesn't fit in a size_t.
+	 */
+	std::vector< SizeT > at(
+		size_t rank ) const
+	{
+		if ( size() <= rank )
+		{
+			throw std::out_of_range( "rank is outside of the enumeration" );
+		}
+
+		size_t subsetSize = mMinimumSubsetSize;
+
+		for ( size_t count; ( count = _count( mNumberElements, subsetSize ) ) <= rank; ++subsetSize )
+		{
+			rank -= count;
+		}
+
+		return BasicCombination< SizeT >( mNumberElements, subsetSize ).at( rank );
+	}
+
+	/**
+	 * Beginning iterator.
+	 * @return Iterator to the beginning of the combination enumeration.
+	 */
+	const_iterator begin() const
+	{
+		return const_iterator( false, *this, mMinimumSubsetSize, 0 );
+	}
+
+	/**
+	 * End iterator.
+	 * @return Iterator to the end of the combination enumeration.
+	 */
+	const_iterator end() const
+	{
+		return const_iterator( true, *this, 0, 0 );
+	}
+
+	/**
+	 * The largest number of elements to choose.
+	 * @return The maximum subset size.
+	 */
+	size_t maximumSubsetSize() const
+	{
+		return mMaximumSubsetSize;
+	}
+
+	/**
+	 * The smallest number of elements to choose.
+	 * @return The minimum subset size.
+	 */
+	size_t minimumSubsetSize() const
+	{
+		return mMinimumSubsetSize;
+	}
+
+	/**
+	 * The number of elements.
+	 * @return The number of elements.
+	 */
+	size_t numberElements() const
+	{
+		return mNumberElements;
+	}
+
+	/**
+	 * Move assignment operator.
+	 * @param other R-Value to the PowerSetCombination object to move to this instance.
+	 * @return Reference to this PowerSetCombination object is returned.
+	 */
+	PowerSetCombination& operator=(
+		PowerSetCombination&& other )
+	{
+		if ( this != &other )
+		{
+			_moveAssign( std::move( other ) );
+		}
+
+		return *this;
+	}
+
+	/**
+	 * Copy assignment operator.
+	 * @param other Const reference to the PowerSetCombination object to copy to this instance.
+	 * @return Reference to this PowerSetCombination object is returned.
+	 */
+	PowerSetCombination& operator=(
+		const PowerSetCombination& other )
+	{
+		if ( this != &other )
+		{
+			_copyAssign( other );
+		}
+
+		return *this;
+	}
+
+	/**
+	 * The rank of a subset within the enumeration.
+	 * @param subset Const reference to the strictly increasing offsets of the subset.
+	 * @return Rank of {@param subset} in banker's order, starting from 0.
+	 * @throw std::invalid_argument if {@param subset} isn't part of the enumeration.
+	 * @throw std::overflow_error if the number of subsets doesn't fit in a size_t.
+	 */
+	size_t rank(
+		const std::vector< SizeT >& subset ) const
+	{
+		size_t total = size();
+
+		if ( ( 0 == total ) or ( subset.size() < mMinimumSubsetSize ) or ( mMaximumSubsetSize < subset.size() ) )
+		{
+			throw std::invalid_argument( "subset isn't part of the enumeration" );
+		}
+
+		size_t rank = BasicCombination< SizeT >( mNumberElements, subset.size() ).rank( subset );
+
+		for ( size_t subsetSize = mMinimumSubsetSize; subsetSize < subset.size(); ++subsetSize )
+		{
+			rank += _count( mNumberElements, subsetSize );
+		}
+
+		return rank;
+	}
+
+	/**
+	 * The number of subsets over all of the sizes.
+	 * @return The number of subsets in the enumeration.
+	 * @throw std::overflow_error if the number of subsets doesn't fit in a size_t.
+	 */
+	size_t size() const
+	{
+		size_t total = 0;
+
+		for ( size_t subsetSize = mMinimumSubsetSize; subsetSize <= mMaximumSubsetSize; ++subsetSize )
+		{
+			size_t count = _count( mNumberElements, subsetSize );
+
+			if ( std::numeric_limits< size_t >::max() - total < count )
+			{
+				throw std::overflow_error( "number of subsets exceeds the range of size_t" );
+			}
+
+			total += count;
+		}
+
+		return total;
+	}
+
+	/**
+	 * A contiguous sub-range of the enumeration, which may span several sizes.
+	 * @param firstRank Rank of the first subset of the slice.
+	 * @param count Number of subsets in the slice.
+	 * @return Slice over the subsets of rank [firstRank, firstRank + count).
+	 * @throw std::out_of_range if the slice extends past the end of the enumeration.
+	 * @throw std::overflow_error if the number of subsets doesn't fit in a size_t.
+	 */
+	Slice< const_iterator > slice(
+		size_t firstRank,
+		size_t count ) const
+	{
+		size_t total = size();
+
+		if ( ( total < firstRank ) or ( total - firstRank < count ) )
+		{
+			throw std::out_of_range( "slice is outside of the enumeration" );
+		}
+
+		auto seek = [ this, total ]( size_t rank )
+		{
+			if ( total == rank )
+			{
+				return const_iterator( true, *this, 0, 0 );
+			}
+
+			size_t subsetSize = mMinimumSubsetSize;
+
+			for ( size_t sizeCount; ( sizeCount = _count( mNumberElements, subsetSize ) ) <= rank; ++subsetSize )
+			{
+				rank -= sizeCount;
+			}
+
+			return const_iterator( false, *this, subsetSize, rank );
+		};
+
+		return Slice< const_iterator >( seek( firstRank ), seek( firstRank + count ), firstRank, count );
+	}
+};
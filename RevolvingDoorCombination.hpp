@@ -0,0 +1,492 @@
+/**
+ * Copyright ©2021-2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * Class for enumerating over the subset combinations of a collection
+ * in revolving door order (Knuth, TAOCP 7.2.1.3, Algorithm R), a minimal
+ * change order where every step removes exactly one element from the
+ * subset and adds exactly one other. The iterator reports which offset
+ * left and which entered, so that sums, hashes and products over the
+ * subset can be updated in constant time rather than recomputed.
+ *
+ * As an example of use:
+ *     RevolvingDoorCombination<> combination( weights.size(), 4 );
+ *     auto iterator = combination.begin();
+ *     double sum = 0;
+ *     for ( size_t offset : *iterator ) {
+ *         sum += weights[ offset ]; }
+ *     for ( ++iterator; iterator != combination.end(); ++iterator ) {
+ *         sum += weights[ iterator.entered() ] - weights[ iterator.left() ]; }
+ *
+ * The offsets of each subset are kept in increasing order, and the same
+ * rules for an empty enumeration apply as for Combination.
+ *
+ * Note:
+ *   - Requires C++14 and above.
+ */
+template < typename SizeT = size_t >
+class RevolvingDoorCombination
+{
+	static_assert( std::is_integral< SizeT >::value and std::is_unsigned< SizeT >::value,
+		"SizeT must be an unsigned integral type" );
+
+private:
+	size_t mNumberElements;
+	size_t mSubsetSize;
+
+	void _copyAssign(
+		const RevolvingDoorCombination& other )
+	{
+		mNumberElements = other.mNumberElements;
+		mSubsetSize = other.mSubsetSize;
+	}
+
+	void _moveAssign(
+		RevolvingDoorCombination&& other )
+	{
+		mNumberElements = std::exchange( other.mNumberElements, 0 );
+		mSubsetSize = std::exchange( other.mSubsetSize, 0 );
+	}
+
+public:
+	/**
+	 * Iterator class for enumerating over the subsets
+	 * of a collection in revolving door order.
+	 */
+	class const_iterator
+	{
+	private:
+		friend class RevolvingDoorCombination;
+
+		bool mIsEnd;
+		size_t mNumberElements;
+		size_t mSubsetSize;
+		SizeT mEntered;
+		SizeT mLeft;
+		std::vector< SizeT > mEnumeration;
+
+		const_iterator(
+			bool end,
+			size_t numberElements,
+			size_t subsetSize )
+		{
+			mIsEnd = end;
+			mNumberElements = numberElements;
+			mSubsetSize = subsetSize;
+			mEntered = 0;
+			mLeft = 0;
+
+			if ( not mIsEnd and ( 0 < mSubsetSize ) and ( mSubsetSize <= mNumberElements ) )
+			{
+				mEnumeration.resize( mSubsetSize );
+
+				for ( size_t index( mSubsetSize ); index--;
+					mEnumeration[ index ] = SizeT( index ) );
+			}
+			else
+			{
+				mIsEnd = true;
+			}
+		}
+
+		void _copyAssign(
+			const const_iterator& other )
+		{
+			mIsEnd = other.mIsEnd;
+			mEnumeration = other.mEnumeration;
+			mNumberElements = other.mNumberElements;
+			mSubsetSize = other.mSubsetSize;
+			mEntered = other.mEntered;
+			mLeft = other.mLeft;
+		}
+
+		void _moveAssign(
+			const_iterator&& other )
+		{
+			mIsEnd = std::exchange( other.mIsEnd, true );
+			mEnumeration = std::move( other.mEnumeration );
+			mNumberElements = std::exchange( other.mNumberElements, 0 );
+			mSubsetSize = std::exchange( other.mSubsetSize, 0 );
+			mEntered = std::exchange( other.mEntered, 0 );
+			mLeft = std::exchange( other.mLeft, 0 );
+		}
+
+		// The offset at one-based position j of Algorithm R, where
+		// position K + 1 is the sentinel N.
+		size_t _at(
+			size_t j ) const
+		{
+			return ( j <= mSubsetSize ) ? mEnumeration[ j - 1 ] : mNumberElements;
+		}
+
+		void _swap(
+			size_t position,
+			size_t offset )
+		{
+			mLeft = mEnumeration[ position ];
+			mEntered = SizeT( offset );
+			mEnumeration[ position ] = SizeT( offset );
+		}
+
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using difference_type   = std::ptrdiff_t;
+		using value_type        = const std::vector< SizeT >;
+		using pointer           = const std::vector< SizeT >*;
+		using reference         = const std::vector< SizeT >&;
+
+		/**
+		 * Default constructor.
+		 */
+		const_iterator()
+		{
+			mNumberElements = 0;
+			mSubsetSize = 0;
+			mEntered = 0;
+			mLeft = 0;
+			mIsEnd = true;
+		}
+
+		/**
+		 * Move constructor.
+		 * @param other R-Value to the iterator to move.
+		 */
+		const_iterator(
+			const_iterator&& other )
+		{
+			_moveAssign( std::move( other ) );
+		}
+
+		/**
+		 * Copy constructor.
+		 * @param other Const reference to the iterator to copy.
+		 */
+		const_iterator(
+			const const_iterator& other )
+		{
+			_copyAssign( other );
+		}
+
+		/**
+		 * Move assignment.
+		 * @param other R-Value to the iterator to move.
+		 * @return Reference to this iterator instance.
+		 */
+		const_iterator& operator=(
+			const_iterator&& other )
+		{
+			if ( this != &other )
+			{
+				_moveAssign( std::move( other ) );
+			}
+
+			return *this;
+		}
+
+		/**
+		 * Copy assignment.
+		 * @param other Const reference to the iterator to copy.
+		 * @return Reference to this iterator instance.
+		 */
+		const_iterator& operator=(
+			const const_iterator& other )
+		{
+			if ( this != &other )
+			{
+				_copyAssign( other );
+			}
+
+			return *this;
+		}
+
+		/**
+		 * Equality operator.
+		 * Comparing against an end iterator only tests the end flags.
+		 * @param other Const reference to the iterator to compare against.
+		 * @return Return true if {@param other} compares equal to this iterator instance.
+		 */
+		bool operator==(
+			const const_iterator& other ) const
+		{
+			if ( mIsEnd or other.mIsEnd )
+			{
+				return ( mIsEnd == other.mIsEnd )
+					and ( mNumberElements == other.mNumberElements )
+					and ( mSubsetSize == other.mSubsetSize );
+			}
+
+			return ( mNumberElements == other.mNumberElements )
+				and ( mSubsetSize == other.mSubsetSize )
+				and ( mEnumeration == other.mEnumeration );
+		}
+
+		/**
+		 * Inequality operator.
+		 * @param other Const reference to the iterator to compare against.
+		 * @return Return true if {@param other} compares not equal to this iterator instance.
+		 */
+		bool operator!=(
+			const const_iterator& other ) const
+		{
+			return not this->operator==( other );
+		}
+
+		/**
+		 * Member redirect.
+		 * @return Const pointer to the enumeration.
+		 */
+		pointer operator->() const
+		{
+			return &mEnumeration;
+		}
+
+		/**
+		 * Dereference operator.
+		 * @return Const reference to the enumeration.
+		 */
+		reference operator*() const
+		{
+			return mEnumeration;
+		}
+
+		/**
+		 * The offset that entered the subset on the last increment.
+		 * @return The entering offset, 0 before the first increment.
+		 */
+		SizeT entered() const
+		{
+			return mEntered;
+		}
+
+		/**
+		 * The offset that left the subset on the last increment.
+		 * @return The leaving offset, 0 before the first increment.
+		 */
+		SizeT left() const
+		{
+			return mLeft;
+		}
+
+		/**
+		 * Post-increment operator.
+		 * @return iterator to the prior enumeration.
+		 */
+		const_iterator operator++( int )
+		{
+			const_iterator previous( *this );
+			this->operator++();
+			return previous;
+		}
+
+		/**
+		 * Pre-increment operator.
+		 * Swaps exactly one offset out of the subset and one in.
+		 * @return Reference to this iterator instance.
+		 */
+		const_iterator& operator++()
+		{
+			if ( mIsEnd )
+			{
+				return *this;
+			}
+
+			const size_t t = mSubsetSize;
+			size_t j = 2;
+			bool increase;
+
+			// R3, the easy case of moving the smallest offset.
+			if ( t & 1 )
+			{
+				if ( _at( 1 ) + 1 < _at( 2 ) )
+				{
+					_swap( 0, _at( 1 ) + 1 );
+					return *this;
+				}
+
+				increase = false;
+			}
+			else
+			{
+				if ( 0 < _at( 1 ) )
+				{
+					_swap( 0, _at( 1 ) - 1 );
+					return *this;
+				}
+
+				increase = true;
+			}
+
+			for ( ; j <= t; )
+			{
+				if ( not increase )
+				{
+					// R4, try to decrease c_j.
+					if ( j <= _at( j ) )
+					{
+						mLeft = mEnumeration[ j - 1 ];
+						mEntered = SizeT( j - 2 );
+						mEnumeration[ j - 1 ] = mEnumeration[ j - 2 ];
+						mEnumeration[ j - 2 ] = SizeT( j - 2 );
+						return *this;
+					}
+
+					++j;
+				}
+
+				if ( j <= t )
+				{
+					// R5, try to increase c_j.
+					if ( _at( j ) + 1 < _at( j + 1 ) )
+					{
+						mLeft = mEnumeration[ j - 2 ];
+						mEntered = SizeT( _at( j ) + 1 );
+						mEnumeration[ j - 2 ] = mEnumeration[ j - 1 ];
+						mEnumeration[ j - 1 ] = mEntered;
+						return *this;
+					}
+
+					++j;
+				}
+
+				increase = false;
+			}
+
+			mIsEnd = true;
+			return *this;
+		}
+
+		/**
+		 * Swap this iterator with another.
+		 * @param other Reference to the iterator to swap with.
+		 */
+		void swap(
+			const_iterator& other )
+		{
+			std::swap( mIsEnd, other.mIsEnd );
+			std::swap( mNumberElements, other.mNumberElements );
+			std::swap( mSubsetSize, other.mSubsetSize );
+			std::swap( mEntered, other.mEntered );
+			std::swap( mLeft, other.mLeft );
+			std::swap( mEnumeration, other.mEnumeration );
+		}
+	};
+
+	/**
+	 * Default constructor.
+	 * @param numberElements Number of elements to choose from. [default: 0]
+	 * @param subsetSize Numer of element to choose. [default: 0]
+	 * @throw std::invalid_argument if the offsets of {@param numberElements} can't be represented by SizeT.
+	 */
+	RevolvingDoorCombination(
+		size_t numberElements = 0,
+		size_t subsetSize = 0 )
+	{
+		if ( ( 0 < numberElements ) and ( std::numeric_limits< SizeT >::max() < numberElements - 1 ) )
+		{
+			throw std::invalid_argument( "numberElements exceeds the range of SizeT" );
+		}
+
+		mNumberElements = numberElements;
+		mSubsetSize = subsetSize;
+	}
+
+	/**
+	 * Move constructor.
+	 * @param other R-Value to the RevolvingDoorCombination to move.
+	 */
+	RevolvingDoorCombination(
+		RevolvingDoorCombination&& other )
+	{
+		_moveAssign( std::move( other ) );
+	}
+
+	/**
+	 * Copy constructor.
+	 * @param other Const reference to the RevolvingDoorCombination to copy.
+	 */
+	RevolvingDoorCombination(
+		const RevolvingDoorCombination& other )
+	{
+		_copyAssign( other );
+	}
+
+	/**
+	 * Beginning iterator.
+	 * @return Iterator to the beginning of the combination enumeration.
+	 */
+	const_iterator begin() const
+	{
+		return const_iterator( false, mNumberElements, mSubsetSize );
+	}
+
+	/**
+	 * End iterator.
+	 * @return Iterator to the end of the combination enumeration.
+	 */
+	const_iterator end() const
+	{
+		return const_iterator( true, mNumberElements, mSubsetSize );
+	}
+
+	/**
+	 * The number of elements.
+	 * @return The number of elements.
+	 */
+	size_t numberElements() const
+	{
+		return mNumberElements;
+	}
+
+	/**
+	 * Move assignment operator.
+	 * @param other R-Value to the RevolvingDoorCombination object to move to this instance.
+	 * @return Reference to this RevolvingDoorCombination object is returned.
+	 */
+	RevolvingDoorCombination& operator=(
+		RevolvingDoorCombination&& other )
+	{
+		if ( this != &other )
+		{
+			_moveAssign( std::move( other ) );
+		}
+
+		return *this;
+	}
+
+	/**
+	 * Copy assignment operator.
+	 * @param other Const reference to the RevolvingDoorCombination object to copy to this instance.
+	 * @return Reference to this RevolvingDoorCombination object is returned.
+	 */
+	RevolvingDoorCombination& operator=(
+		const RevolvingDoorCombination& other )
+	{
+		if ( this != &other )
+		{
+			_copyAssign( other );
+		}
+
+		return *this;
+	}
+
+	/**
+	 * The number of elements to choose from.
+	 * @return The subset size.
+	 */
+	size_t subsetSize() const
+	{
+		return mSubsetSize;
+	}
+};
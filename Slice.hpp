@@ -0,0 +1,191 @@
+/**
+ * Copyright ©2021-2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+#if defined( __cpp_lib_ranges )
+#include <ranges>
+#endif
+
+/**
+ * Class holding a contiguous sub-range of an enumeration, as returned by
+ * Combination::slice and Combination::split. Each slice owns its own pair
+ * of iterators, so slices can be handed to separate threads without any
+ * shared state.
+ *
+ * As an example of use:
+ *     Combination combination( 60, 8 );
+ *     for ( const auto& slice : combination.split( 4 ) ) {
+ *         pool.submit( [ slice ]() {
+ *             for ( const auto& subset : slice ) {
+ *                 process( subset ); } } ); }
+ *
+ * Note:
+ *   - Requires C++14 and above.
+ */
+template < typename ConstIterator >
+class Slice
+{
+private:
+	ConstIterator mBegin;
+	ConstIterator mEnd;
+	size_t mFirstRank;
+	size_t mSize;
+
+	void _copyAssign(
+		const Slice& other )
+	{
+		mBegin = other.mBegin;
+		mEnd = other.mEnd;
+		mFirstRank = other.mFirstRank;
+		mSize = other.mSize;
+	}
+
+	void _moveAssign(
+		Slice&& other )
+	{
+		mBegin = std::move( other.mBegin );
+		mEnd = std::move( other.mEnd );
+		mFirstRank = std::exchange( other.mFirstRank, 0 );
+		mSize = std::exchange( other.mSize, 0 );
+	}
+
+public:
+	using const_iterator = ConstIterator;
+
+	/**
+	 * Default constructor, an empty slice.
+	 */
+	Slice()
+	{
+		mFirstRank = 0;
+		mSize = 0;
+	}
+
+	/**
+	 * Parameter constructor.
+	 * @param begin Iterator to the first subset of the slice.
+	 * @param end Iterator to one past the last subset of the slice.
+	 * @param firstRank Rank of the first subset of the slice within the enumeration.
+	 * @param size Number of subsets in the slice.
+	 */
+	Slice(
+		ConstIterator begin,
+		ConstIterator end,
+		size_t firstRank,
+		size_t size ) :
+		mBegin( std::move( begin ) ),
+		mEnd( std::move( end ) )
+	{
+		mFirstRank = firstRank;
+		mSize = size;
+	}
+
+	/**
+	 * Move constructor.
+	 * @param other R-Value to the Slice to move.
+	 */
+	Slice(
+		Slice&& other )
+	{
+		_moveAssign( std::move( other ) );
+	}
+
+	/**
+	 * Copy constructor.
+	 * @param other Const reference to the Slice to copy.
+	 */
+	Slice(
+		const Slice& other )
+	{
+		_copyAssign( other );
+	}
+
+	/**
+	 * Beginning iterator.
+	 * @return Iterator to the first subset of the slice.
+	 */
+	const_iterator begin() const
+	{
+		return mBegin;
+	}
+
+	/**
+	 * End iterator.
+	 * @return Iterator to one past the last subset of the slice.
+	 */
+	const_iterator end() const
+	{
+		return mEnd;
+	}
+
+	/**
+	 * The rank of the first subset of the slice.
+	 * @return Rank of the first subset within the whole enumeration.
+	 */
+	size_t firstRank() const
+	{
+		return mFirstRank;
+	}
+
+	/**
+	 * Move assignment operator.
+	 * @param other R-Value to the Slice object to move to this instance.
+	 * @return Reference to this Slice object is returned.
+	 */
+	Slice& operator=(
+		Slice&& other )
+	{
+		if ( this != &other )
+		{
+			_moveAssign( std::move( other ) );
+		}
+
+		return *this;
+	}
+
+	/**
+	 * Copy assignment operator.
+	 * @param other Const reference to the Slice object to copy to this instance.
+	 * @return Reference to this Slice object is returned.
+	 */
+	Slice& operator=(
+		const Slice& other )
+	{
+		if ( this != &other )
+		{
+			_copyAssign( other );
+		}
+
+		return *this;
+	}
+
+	/**
+	 * The number of subsets in the slice.
+	 * @return The number of subsets.
+	 */
+	size_t size() const
+	{
+		return mSize;
+	}
+};
+
+#if defined( __cpp_lib_ranges )
+/**
+ * The iterators of a Slice don't refer back to it, so they may outlive it.
+ */
+namespace std
+{
+namespace ranges
+{
+template < typename ConstIterator >
+inline constexpr bool enable_borrowed_range< Slice< ConstIterator > > = true;
+}
+}
+#endif
@@ -0,0 +1,422 @@
+/**
+ * Copyright ©2021-2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Mutating a std::array is only constexpr from C++17, so the
+// enumeration can only be run at compile time from then on.
+#if defined( __cpp_lib_array_constexpr ) && ( 201603L <= __cpp_lib_array_constexpr )
+#define STATIC_COMBINATION_CONSTEXPR constexpr
+#else
+#define STATIC_COMBINATION_CONSTEXPR
+#endif
+
+/**
+ * Class for enumerating over the subset combinations of a
+ * set/vector/array/etc where the subset size is known at compile time.
+ * The enumeration is held in a std::array inside of the iterator,
+ * so the iterator is trivially copyable and iterating never touches
+ * the allocator.
+ *
+ * As an example of use:
+ *     std::vector< char > characters { 'a', 'b', 'c', 'd', 'e', 'f', 'g' };
+ *     for ( const auto& subset : StaticCombination< 4 >( characters.size() ) ) {
+ *         for ( size_t offset : subset ) {
+ *             std::cout << " " << characters[ offset ]; }
+ *         std::cout << std::endl; }
+ *
+ * As with BasicCombination, the offsets are stored as SizeT [default: size_t].
+ *
+ * From C++17 the enumeration is constexpr, so it can be run at compile
+ * time, as makeCombinationTable does to place a whole table in read-only data.
+ *
+ * Note:
+ *   - Requires C++14 and above.
+ */
+template < size_t SubsetSize, typename SizeT = size_t >
+class StaticCombination
+{
+	static_assert( std::is_integral< SizeT >::value and std::is_unsigned< SizeT >::value,
+		"SizeT must be an unsigned integral type" );
+
+private:
+	size_t mNumberElements;
+
+	constexpr void _copyAssign(
+		const StaticCombination& other )
+	{
+		mNumberElements = other.mNumberElements;
+	}
+
+	// std::exchange isn't constexpr before C++20.
+	constexpr void _moveAssign(
+		StaticCombination&& other )
+	{
+		mNumberElements = other.mNumberElements;
+		other.mNumberElements = 0;
+	}
+
+public:
+	/**
+	 * Iterator class for enumerating over the subsets
+	 * of a collection.
+	 */
+	class const_iterator
+	{
+	private:
+		friend class StaticCombination;
+
+		bool mIsEnd;
+		size_t mNumberElements;
+		std::array< SizeT, SubsetSize > mEnumeration;
+
+		STATIC_COMBINATION_CONSTEXPR const_iterator(
+			bool end,
+			size_t numberElements ) :
+			mIsEnd( end ),
+			mNumberElements( numberElements ),
+			mEnumeration()
+		{
+			if ( not mIsEnd and ( 0 < SubsetSize ) and ( SubsetSize <= mNumberElements ) )
+			{
+				for ( size_t index( SubsetSize ); index--;
+					mEnumeration[ index ] = SizeT( index ) );
+			}
+			else
+			{
+				mIsEnd = true;
+			}
+		}
+
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using difference_type   = std::ptrdiff_t;
+		using value_type        = const std::array< SizeT, SubsetSize >;
+		using pointer           = const std::array< SizeT, SubsetSize >*;
+		using reference         = const std::array< SizeT, SubsetSize >&;
+
+		/**
+		 * Default constructor.
+		 */
+		constexpr const_iterator() :
+			mIsEnd( true ),
+			mNumberElements( 0 ),
+			mEnumeration()
+		{
+		}
+
+		/**
+		 * Move constructor.
+		 * @param other R-Value to the iterator to move.
+		 */
+		const_iterator(
+			const_iterator&& other ) = default;
+
+		/**
+		 * Copy constructor.
+		 * @param other Const reference to the iterator to copy.
+		 */
+		const_iterator(
+			const const_iterator& other ) = default;
+
+		/**
+		 * Move assignment.
+		 * @param other R-Value to the iterator to move.
+		 * @return Reference to this iterator instance.
+		 */
+		const_iterator& operator=(
+			const_iterator&& other ) = default;
+
+		/**
+		 * Copy assignment.
+		 * @param other Const reference to the iterator to copy.
+		 * @return Reference to this iterator instance.
+		 */
+		const_iterator& operator=(
+			const const_iterator& other ) = default;
+
+		/**
+		 * Equality operator.
+		 * Comparing against an end iterator only tests the end flags.
+		 * @param other Const reference to the iterator to compare against.
+		 * @return Return true if {@param other} compares equal to this iterator instance.
+		 */
+		constexpr bool operator==(
+			const const_iterator& other ) const
+		{
+			if ( mIsEnd or other.mIsEnd )
+			{
+				return ( mIsEnd == other.mIsEnd )
+					and ( mNumberElements == other.mNumberElements );
+			}
+
+			// std::array's comparison isn't constexpr before C++20.
+			for ( size_t index = SubsetSize; index--; )
+			{
+				if ( mEnumeration[ index ] != other.mEnumeration[ index ] )
+				{
+					return false;
+				}
+			}
+
+			return mNumberElements == other.mNumberElements;
+		}
+
+		/**
+		 * Inequality operator.
+		 * @param other Const reference to the iterator to compare against.
+		 * @return Return true if {@param other} compares not equal to this iterator instance.
+		 */
+		constexpr bool operator!=(
+			const const_iterator& other ) const
+		{
+			return not this->operator==( other );
+		}
+
+		/**
+		 * Member redirect.
+		 * @return Const pointer to the enumeration.
+		 */
+		constexpr pointer operator->() const
+		{
+			return &mEnumeration;
+		}
+
+		/**
+		 * Dereference operator.
+		 * @return Const reference to the enumeration.
+		 */
+		constexpr reference operator*() const
+		{
+			return mEnumeration;
+		}
+
+		/**
+		 * Post-increment operator.
+		 * @return iterator to the prior enumeration.
+		 */
+		STATIC_COMBINATION_CONSTEXPR const_iterator operator++( int )
+		{
+			const_iterator previous( *this );
+			this->operator++();
+			return previous;
+		}
+
+		/**
+		 * Pre-increment operator.
+		 * @return Reference to this iterator instance.
+		 */
+		STATIC_COMBINATION_CONSTEXPR const_iterator& operator++()
+		{
+			size_t index = SubsetSize;
+			for ( ; index-- && mEnumeration[ index ] == ( mNumberElements - SubsetSize + index ); );
+
+			if ( size_t( -1 ) != index )
+			{
+				for ( mEnumeration[ index ]++; ++index < SubsetSize;
+					mEnumeration[ index ] = SizeT( mEnumeration[ index - 1 ] + 1 ) );
+			}
+			else
+			{
+				mIsEnd = true;
+			}
+
+			return *this;
+		}
+
+		/**
+		 * Swap this iterator with another.
+		 * @param other Reference to the iterator to swap with.
+		 */
+		void swap(
+			const_iterator& other )
+		{
+			std::swap( mIsEnd, other.mIsEnd );
+			std::swap( mNumberElements, other.mNumberElements );
+			std::swap( mEnumeration, other.mEnumeration );
+		}
+	};
+
+	/**
+	 * Default constructor.
+	 * @param numberElements Number of elements to choose from. [default: 0]
+	 * @throw std::invalid_argument if the offsets of {@param numberElements} can't be represented by SizeT.
+	 */
+	constexpr StaticCombination(
+		size_t numberElements = 0 ) :
+		mNumberElements( 0 )
+	{
+		if ( ( 0 < numberElements ) and ( std::numeric_limits< SizeT >::max() < numberElements - 1 ) )
+		{
+			throw std::invalid_argument( "numberElements exceeds the range of SizeT" );
+		}
+
+		mNumberElements = numberElements;
+	}
+
+	/**
+	 * Move constructor.
+	 * @param other R-Value to the StaticCombination to move.
+	 */
+	constexpr StaticCombination(
+		StaticCombination&& other ) :
+		mNumberElements( 0 )
+	{
+		_moveAssign( std::move( other ) );
+	}
+
+	/**
+	 * Copy constructor.
+	 * @param other Const reference to the StaticCombination to copy.
+	 */
+	constexpr StaticCombination(
+		const StaticCombination& other ) :
+		mNumberElements( 0 )
+	{
+		_copyAssign( other );
+	}
+
+	/**
+	 * Beginning iterator.
+	 * @return Iterator to the beginning of the combination enumeration.
+	 */
+	STATIC_COMBINATION_CONSTEXPR const_iterator begin() const
+	{
+		return const_iterator( false, mNumberElements );
+	}
+
+	/**
+	 * End iterator.
+	 * @return Iterator to the end of the combination enumeration.
+	 */
+	STATIC_COMBINATION_CONSTEXPR const_iterator end() const
+	{
+		return const_iterator( true, mNumberElements );
+	}
+
+	/**
+	 * The number of elements.
+	 * @return The number of elements.
+	 */
+	constexpr size_t numberElements() const
+	{
+		return mNumberElements;
+	}
+
+	/**
+	 * Move assignment operator.
+	 * @param other R-Value to the StaticCombination object to move to this instance.
+	 * @return Reference to this StaticCombination object is returned.
+	 */
+	constexpr StaticCombination& operator=(
+		StaticCombination&& other )
+	{
+		if ( this != &other )
+		{
+			_moveAssign( std::move( other ) );
+		}
+
+		return *this;
+	}
+
+	/**
+	 * Copy assignment operator.
+	 * @param other Const reference to the StaticCombination object to copy to this instance.
+	 * @return Reference to this StaticCombination object is returned.
+	 */
+	constexpr StaticCombination& operator=(
+		const StaticCombination& other )
+	{
+		if ( this != &other )
+		{
+			_copyAssign( other );
+		}
+
+		return *this;
+	}
+
+	/**
+	 * The number of elements to choose from.
+	 * @return The subset size.
+	 */
+	constexpr size_t subsetSize() const
+	{
+		return SubsetSize;
+	}
+};
+
+/**
+ * The number of subsets, N choose K, for sizing a compile time table.
+ * @param numberElements Number of elements to choose from.
+ * @param subsetSize Numer of element to choose.
+ * @return N choose K.
+ * @throw std::overflow_error if N choose K doesn't fit in a size_t, which at
+ *     compile time stops the expression from being a constant.
+ */
+constexpr size_t combinationTableSize(
+	size_t numberElements,
+	size_t subsetSize )
+{
+	if ( numberElements < subsetSize )
+	{
+		return 0;
+	}
+
+	size_t count = 1;
+	for ( size_t index = 1; index <= subsetSize; ++index )
+	{
+		// count * factor is always divisible by index, being index times C( n, index ).
+		size_t factor = numberElements - subsetSize + index;
+
+		if ( ( std::numeric_limits< size_t >::max() / factor ) < count )
+		{
+			throw std::overflow_error( "number of subsets exceeds the range of size_t" );
+		}
+
+		count = count * factor / index;
+	}
+
+	return ( 0 < subsetSize ) ? count : 0;
+}
+
+/**
+ * Build the table of every K element subset of N, in enumeration order.
+ * Assigned to a constexpr variable, the table is built by the compiler and
+ * stored in read-only data, rather than enumerated on every launch.
+ *
+ * As an example of use:
+ *     static constexpr auto table = makeCombinationTable< 8, 3, uint8_t >();
+ *     static_assert( table.size() == 56, "8 choose 3" );
+ *
+ * Note:
+ *   - Evaluating at compile time requires C++17 and above.
+ *
+ * @return Array of C( N, K ) subsets, each an array of K offsets.
+ */
+template < size_t NumberElements, size_t SubsetSize, typename SizeT = size_t >
+STATIC_COMBINATION_CONSTEXPR std::array< std::array< SizeT, SubsetSize >, combinationTableSize( NumberElements, SubsetSize ) >
+makeCombinationTable()
+{
+	static_assert( ( 0 == NumberElements ) or ( NumberElements - 1 <= std::numeric_limits< SizeT >::max() ),
+		"NumberElements exceeds the range of SizeT" );
+
+	std::array< std::array< SizeT, SubsetSize >, combinationTableSize( NumberElements, SubsetSize ) > table {};
+	size_t index = 0;
+
+	for ( const auto& subset : StaticCombination< SubsetSize, SizeT >( NumberElements ) )
+	{
+		table[ index++ ] = subset;
+	}
+
+	return table;
+}
@@ -0,0 +1,82 @@
+/**
+ * Copyright ©2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#pragma once
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * Free functions for the variable length integers, LEB128, shared by
+ * CombinationCheckpoint and the Delta format of CombinationWriter and
+ * CombinationReader. A value is written seven bits per byte, low bits
+ * first, with the high bit set on every byte but the last, so small
+ * values such as the gaps between offsets take a single byte.
+ *
+ * As an example of use:
+ *     std::vector< uint8_t > bytes;
+ *     writeVarint( bytes, 300 );
+ *     const uint8_t* data = bytes.data();
+ *     uint64_t value = readVarint( data, data + bytes.size() );
+ *
+ * Note:
+ *   - Requires C++14 and above.
+ */
+
+/**
+ * Append {@param value} as a variable length integer.
+ * @param bytes Reference to the bytes to append to.
+ * @param value The value to write.
+ */
+inline void writeVarint(
+	std::vector< uint8_t >& bytes,
+	uint64_t value )
+{
+	for ( ; 0x80 <= value; value >>= 7 )
+	{
+		bytes.push_back( uint8_t( value | 0x80 ) );
+	}
+
+	bytes.push_back( uint8_t( value ) );
+}
+
+/**
+ * Read a variable length integer, stepping {@param data} past it.
+ * @param data Reference to the pointer to read from, left one past the value read.
+ * @param last Const pointer to one past the last byte that may be read.
+ * @return The value read.
+ * @throw std::invalid_argument if the value runs past {@param last} or exceeds 64 bits.
+ */
+inline uint64_t readVarint(
+	const uint8_t*& data,
+	const uint8_t* last )
+{
+	uint64_t value = 0;
+
+	for ( unsigned shift = 0; shift < 64; shift += 7 )
+	{
+		if ( data == last )
+		{
+			throw std::invalid_argument( "variable length integer is truncated" );
+		}
+
+		uint8_t byte = *data++;
+
+		if ( ( 63 == shift ) and ( 1 < byte ) )
+		{
+			break;
+		}
+
+		value |= uint64_t( byte & 0x7F ) << shift;
+
+		if ( 0 == ( byte & 0x80 ) )
+		{
+			return value;
+		}
+	}
+
+	throw std::invalid_argument( "variable length integer exceeds 64 bits" );
+}
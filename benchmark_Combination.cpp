@@ -0,0 +1,299 @@
+/**
+ * Copyright ©2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#include "BitmaskCombination.hpp"
+#include "Combination.hpp"
+#include "ParallelForEach.hpp"
+#include "RevolvingDoorCombination.hpp"
+#include "StaticCombination.hpp"
+
+/**
+ * Notes:
+ *   - Requires that google benchmark is installed on the system.
+ *
+ * To compile the benchmark
+ *     $ g++ -O3 -march=native benchmark_Combination.cpp -lbenchmark -pthread -o benchmark_all
+ *
+ * Then to run the benchmark
+ *     $ ./benchmark_all
+ *
+ * Every enumeration is run over the same grid of ( N, K ), and reports
+ * ns/subset along with the bytes and calls to the allocator per iteration,
+ * counted by the replacement operator new below.
+ */
+
+// GCC sees operator delete inlined against operator new and warns that
+// free is called on memory from new, though both are replaced here.
+#if defined( __GNUC__ ) && !defined( __clang__ ) && ( 11 <= __GNUC__ )
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+static std::atomic< size_t > gAllocatedBytes( 0 );
+static std::atomic< size_t > gAllocations( 0 );
+
+void* operator new(
+	size_t size )
+{
+	gAllocatedBytes.fetch_add( size, std::memory_order_relaxed );
+	gAllocations.fetch_add( 1, std::memory_order_relaxed );
+
+	if ( void* pointer = std::malloc( size ? size : 1 ) )
+	{
+		return pointer;
+	}
+
+	throw std::bad_alloc();
+}
+
+void operator delete(
+	void* pointer ) noexcept
+{
+	std::free( pointer );
+}
+
+void operator delete(
+	void* pointer,
+	size_t ) noexcept
+{
+	std::free( pointer );
+}
+
+/**
+ * Class recording the allocator traffic over the lifetime of a benchmark,
+ * and reporting it along with the subset rate on destruction.
+ */
+class AllocationReport
+{
+private:
+	benchmark::State& mState;
+	size_t mBytes;
+	size_t mAllocations;
+
+public:
+	explicit AllocationReport(
+		benchmark::State& state ) :
+		mState( state )
+	{
+		mBytes = gAllocatedBytes.load();
+		mAllocations = gAllocations.load();
+	}
+
+	~AllocationReport()
+	{
+		mState.counters[ "bytes" ] = benchmark::Counter( double( gAllocatedBytes.load() - mBytes ), benchmark::Counter::kAvgIterations );
+		mState.counters[ "allocs" ] = benchmark::Counter( double( gAllocations.load() - mAllocations ), benchmark::Counter::kAvgIterations );
+		mState.counters[ "ns/subset" ] = benchmark::Counter( double( mState.items_processed() ) * 1e-9,
+			benchmark::Counter::kIsRate | benchmark::Counter::kInvert );
+	}
+};
+
+// The ( N, K ) grid shared by all of the enumerations, with N <= 64 for the bitmask.
+static void combinationGrid(
+	benchmark::internal::Benchmark* benchmark )
+{
+	benchmark->ArgNames( { "N", "K" } );
+
+	for ( const auto& arguments : std::vector< std::vector< int64_t > > {
+		{ 20, 4 }, { 24, 12 }, { 32, 8 }, { 40, 4 }, { 64, 4 } } )
+	{
+		benchmark->Args( arguments );
+	}
+}
+
+static void BM_Combination(
+	benchmark::State& state )
+{
+	AllocationReport report( state );
+	Combination combination( state.range( 0 ), state.range( 1 ) );
+	size_t count = 0;
+
+	for ( auto _ : state )
+	{
+		for ( const auto& subset : combination )
+		{
+			benchmark::DoNotOptimize( subset.back() );
+			++count;
+		}
+	}
+
+	state.SetItemsProcessed( count );
+}
+BENCHMARK( BM_Combination )->Apply( combinationGrid );
+
+static void BM_CombinationNarrow(
+	benchmark::State& state )
+{
+	AllocationReport report( state );
+	BasicCombination< uint8_t > combination( state.range( 0 ), state.range( 1 ) );
+	size_t count = 0;
+
+	for ( auto _ : state )
+	{
+		for ( const auto& subset : combination )
+		{
+			benchmark::DoNotOptimize( subset.back() );
+			++count;
+		}
+	}
+
+	state.SetItemsProcessed( count );
+}
+BENCHMARK( BM_CombinationNarrow )->Apply( combinationGrid );
+
+template < size_t SubsetSize >
+static void BM_StaticCombination(
+	benchmark::State& state )
+{
+	AllocationReport report( state );
+	StaticCombination< SubsetSize > combination( state.range( 0 ) );
+	size_t count = 0;
+
+	for ( auto _ : state )
+	{
+		for ( const auto& subset : combination )
+		{
+			benchmark::DoNotOptimize( subset.back() );
+			++count;
+		}
+	}
+
+	state.SetItemsProcessed( count );
+}
+BENCHMARK_TEMPLATE( BM_StaticCombination, 4 )->ArgNames( { "N" } )->Arg( 20 )->Arg( 40 )->Arg( 64 );
+BENCHMARK_TEMPLATE( BM_StaticCombination, 8 )->ArgNames( { "N" } )->Arg( 32 );
+BENCHMARK_TEMPLATE( BM_StaticCombination, 12 )->ArgNames( { "N" } )->Arg( 24 );
+
+static void BM_BitmaskCombination(
+	benchmark::State& state )
+{
+	AllocationReport report( state );
+	BitmaskCombination<> combination( state.range( 0 ), state.range( 1 ) );
+	size_t count = 0;
+
+	for ( auto _ : state )
+	{
+		for ( uint64_t mask : combination )
+		{
+			benchmark::DoNotOptimize( mask );
+			++count;
+		}
+	}
+
+	state.SetItemsProcessed( count );
+}
+BENCHMARK( BM_BitmaskCombination )->Apply( combinationGrid );
+
+static void BM_CombinationNextBatch(
+	benchmark::State& state )
+{
+	AllocationReport report( state );
+	Combination combination( state.range( 0 ), state.range( 1 ) );
+	const size_t batchSize = 1024;
+	std::vector< size_t > batch( batchSize * combination.subsetSize() );
+	size_t count = 0;
+
+	for ( auto _ : state )
+	{
+		auto iterator = combination.begin();
+
+		for ( size_t written; 0 < ( written = iterator.nextBatch( batch.data(), batchSize ) ); count += written )
+		{
+			benchmark::DoNotOptimize( batch.data() );
+			benchmark::ClobberMemory();
+		}
+	}
+
+	state.SetItemsProcessed( count );
+}
+BENCHMARK( BM_CombinationNextBatch )->Apply( combinationGrid );
+
+static void BM_RevolvingDoorCombination(
+	benchmark::State& state )
+{
+	AllocationReport report( state );
+	RevolvingDoorCombination<> combination( state.range( 0 ), state.range( 1 ) );
+	size_t count = 0;
+
+	for ( auto _ : state )
+	{
+		for ( auto iterator = combination.begin(); iterator != combination.end(); ++iterator )
+		{
+			benchmark::DoNotOptimize( iterator.entered() );
+			++count;
+		}
+	}
+
+	state.SetItemsProcessed( count );
+}
+BENCHMARK( BM_RevolvingDoorCombination )->Apply( combinationGrid );
+
+static void BM_ParallelForEach(
+	benchmark::State& state )
+{
+	AllocationReport report( state );
+	Combination combination( state.range( 0 ), state.range( 1 ) );
+	size_t count = 0;
+
+	for ( auto _ : state )
+	{
+		std::atomic< size_t > visited( 0 );
+
+		parallelForEach( combination, [ & ]( const std::vector< size_t >& subset ) {
+			benchmark::DoNotOptimize( subset.back() );
+			visited.fetch_add( 1, std::memory_order_relaxed ); } );
+
+		count += visited.load();
+	}
+
+	state.SetItemsProcessed( count );
+}
+BENCHMARK( BM_ParallelForEach )->Apply( combinationGrid )->UseRealTime();
+
+// The fixed cost of setting up an enumeration, which ought to be one allocation.
+static void BM_CombinationBeginEnd(
+	benchmark::State& state )
+{
+	AllocationReport report( state );
+	Combination combination( state.range( 0 ), state.range( 1 ) );
+
+	for ( auto _ : state )
+	{
+		auto first = combination.begin();
+		auto last = combination.end();
+		benchmark::DoNotOptimize( first );
+		benchmark::DoNotOptimize( last );
+	}
+
+	state.SetItemsProcessed( state.iterations() );
+}
+BENCHMARK( BM_CombinationBeginEnd )->Apply( combinationGrid );
+
+// The cost of testing a live iterator against end(), which ought to be a flag test.
+static void BM_CombinationCompareEnd(
+	benchmark::State& state )
+{
+	AllocationReport report( state );
+	Combination combination( state.range( 0 ), state.range( 1 ) );
+	auto first = combination.begin();
+	auto last = combination.end();
+
+	for ( auto _ : state )
+	{
+		benchmark::DoNotOptimize( first != last );
+	}
+
+	state.SetItemsProcessed( state.iterations() );
+}
+BENCHMARK( BM_CombinationCompareEnd )->Apply( combinationGrid );
+
+BENCHMARK_MAIN();
@@ -0,0 +1,87 @@
+/**
+ * Copyright ©2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "AlignedAllocator.hpp"
+
+/**
+ * Notes:
+ *   - Requires that gtest is installed on the system.
+ *
+ * To compile the test
+ *     $ g++ test_AlignedAllocator.cpp -L/usr/lib/ -lgtest -lgtest_main -pthread -o test_all
+ *
+ * Then to run the test
+ *     $ ./test_all
+ */
+
+TEST( AlignedAllocator, allocateShouldReturnAlignedStorage )
+{
+	AlignedAllocator< uint8_t, 64 > allocator;
+
+	for ( size_t count = 1; count < 100; count += 7 )
+	{
+		uint8_t* storage = allocator.allocate( count );
+		EXPECT_EQ( 0, reinterpret_cast< uintptr_t >( storage ) % 64 );
+		allocator.deallocate( storage, count );
+	}
+}
+
+TEST( AlignedAllocator, vectorShouldUseAlignedStorage )
+{
+	std::vector< uint32_t, AlignedAllocator< uint32_t, 32 > > buffer( 100, 7 );
+
+	EXPECT_EQ( 0, reinterpret_cast< uintptr_t >( buffer.data() ) % 32 );
+	EXPECT_EQ( 7, buffer[ 99 ] );
+}
+
+TEST( AlignedAllocator, paddedSizeShouldRoundUpToAlignment )
+{
+	EXPECT_EQ( 0, ( AlignedAllocator< uint32_t, 64 >::paddedSize( 0 ) ) );
+	EXPECT_EQ( 16, ( AlignedAllocator< uint32_t, 64 >::paddedSize( 1 ) ) );
+	EXPECT_EQ( 16, ( AlignedAllocator< uint32_t, 64 >::paddedSize( 16 ) ) );
+	EXPECT_EQ( 32, ( AlignedAllocator< uint32_t, 64 >::paddedSize( 17 ) ) );
+	EXPECT_EQ( 8, ( AlignedAllocator< size_t, 64 >::paddedSize( 5 ) ) );
+}
+
+TEST( AlignedAllocator, paddedSizeShouldAlignEveryBlockOfAnOddSizedType )
+{
+	// 12 bytes doesn't divide 64, so a block needs 16 elements, 192 bytes.
+	struct Triple
+	{
+		uint32_t values[ 3 ];
+	};
+
+	using Allocator = AlignedAllocator< Triple, 64 >;
+	EXPECT_EQ( 16, Allocator::paddedSize( 1 ) );
+	EXPECT_EQ( 16, Allocator::paddedSize( 8 ) );
+	EXPECT_EQ( 32, Allocator::paddedSize( 17 ) );
+
+	size_t stride = Allocator::paddedSize( 5 );
+	std::vector< Triple, Allocator > columns( stride * 4 );
+
+	for ( size_t column = 0; column < 4; ++column )
+	{
+		EXPECT_EQ( 0, reinterpret_cast< uintptr_t >( columns.data() + column * stride ) % 64 );
+	}
+}
+
+TEST( AlignedAllocator, allocatorsShouldCompareEqual )
+{
+	AlignedAllocator< uint32_t, 64 > allocator;
+	AlignedAllocator< uint8_t, 64 > otherAllocator( allocator );
+
+	EXPECT_TRUE( allocator == otherAllocator );
+	EXPECT_FALSE( allocator != otherAllocator );
+}
+
+int main( int argc, char** argv )
+{
+	::testing::InitGoogleTest( &argc, argv );
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,165 @@
+/**
+ * Copyright ©2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+#include "BinomialCoefficient.hpp"
+
+/**
+ * Notes:
+ *   - Requires that gtest is installed on the system.
+ *
+ * To compile the test
+ *     $ g++ test_BinomialCoefficient.cpp -L/usr/lib/ -lgtest -lgtest_main -pthread -o test_all
+ *
+ * Then to run the test
+ *     $ ./test_all
+ */
+
+TEST( BinomialCoefficient, shouldMatchPascalsTriangle )
+{
+	std::vector< size_t > row { 1 };
+
+	for ( size_t n = 0; n < 40; ++n )
+	{
+		for ( size_t k = 0; k <= n; ++k )
+		{
+			size_t coefficient;
+			ASSERT_TRUE( binomialCoefficient( n, k, coefficient ) );
+			ASSERT_EQ( row[ k ], coefficient );
+		}
+
+		std::vector< size_t > next( row.size() + 1, 1 );
+		for ( size_t k = 1; k < row.size(); ++k )
+		{
+			next[ k ] = row[ k - 1 ] + row[ k ];
+		}
+
+		row = next;
+	}
+}
+
+TEST( BinomialCoefficient, shouldBeZeroForKGreaterThanN )
+{
+	size_t coefficient = 1;
+
+	EXPECT_TRUE( binomialCoefficient( 3, 7, coefficient ) );
+	EXPECT_EQ( 0, coefficient );
+}
+
+TEST( BinomialCoefficient, shouldReportLargestRepresentableCoefficient )
+{
+	size_t coefficient;
+
+	EXPECT_TRUE( binomialCoefficient( 67, 33, coefficient ) );
+	EXPECT_EQ( 14226520737620288370ull, coefficient );
+}
+
+TEST( BinomialCoefficient, shouldReportOverflow )
+{
+	size_t coefficient;
+
+	EXPECT_FALSE( binomialCoefficient( 68, 34, coefficient ) );
+	EXPECT_FALSE( binomialCoefficient( 200, 13, coefficient ) );
+}
+
+TEST( FallingFactorial, shouldMatchProductOfFactors )
+{
+	size_t product;
+
+	EXPECT_TRUE( fallingFactorial( 10, 0, product ) );
+	EXPECT_EQ( 1, product );
+	EXPECT_TRUE( fallingFactorial( 10, 3, product ) );
+	EXPECT_EQ( 720, product );
+	EXPECT_TRUE( fallingFactorial( 20, 20, product ) );
+	EXPECT_EQ( 2432902008176640000ull, product );
+	EXPECT_TRUE( fallingFactorial( 3, 7, product ) );
+	EXPECT_EQ( 0, product );
+}
+
+TEST( FallingFactorial, shouldReportOverflow )
+{
+	size_t product;
+
+	EXPECT_FALSE( fallingFactorial( 21, 21, product ) );
+	EXPECT_FALSE( fallingFactorial( 1000, 7, product ) );
+}
+
+TEST( PascalTriangle, shouldMatchComputedCoefficients )
+{
+	const auto& triangle = PascalTriangle64::instance();
+
+	for ( size_t n = 0; n < PascalTriangle64::Rows; ++n )
+	{
+		for ( size_t k = 0; k <= n + 1; ++k )
+		{
+			size_t computed;
+			uint64_t coefficient;
+			bool fits = computeBinomialCoefficient( n, k, computed );
+
+			ASSERT_EQ( fits, triangle.lookup( n, k, coefficient ) ) << n << " choose " << k;
+
+			if ( fits )
+			{
+				ASSERT_EQ( computed, coefficient ) << n << " choose " << k;
+			}
+			else
+			{
+				ASSERT_EQ( PascalTriangle64::Saturated, coefficient );
+			}
+		}
+	}
+}
+
+TEST( PascalTriangle, shouldBeSharedAndBoundsChecked )
+{
+	uint64_t coefficient;
+
+	EXPECT_EQ( &PascalTriangle64::instance(), &PascalTriangle64::instance() );
+	EXPECT_THROW( PascalTriangle64::instance().lookup( PascalTriangle64::Rows, 2, coefficient ), std::out_of_range );
+	EXPECT_EQ( 0, PascalTriangle64::instance().saturated( 3, 7 ) );
+}
+
+#if defined( __SIZEOF_INT128__ ) && !defined( COMBINATION_DISABLE_INT128 )
+TEST( PascalTriangle, wideTriangleShouldHoldEveryCoefficientExactly )
+{
+	const auto& triangle = PascalTriangle128::instance();
+	unsigned __int128 coefficient;
+
+	// 127 choose 63 = 11975573020964041433067793888190275875.
+	unsigned __int128 expected = ( unsigned __int128 )( 11975573020964041433ull ) * 1000000000000000000ull + 67793888190275875ull;
+
+	EXPECT_TRUE( triangle.lookup( 127, 63, coefficient ) );
+	EXPECT_TRUE( expected == coefficient );
+
+	for ( size_t n = 1; n < PascalTriangle128::Rows; ++n )
+	{
+		for ( size_t k = 1; k < n; ++k )
+		{
+			ASSERT_TRUE( triangle.saturated( n, k ) == triangle.saturated( n - 1, k - 1 ) + triangle.saturated( n - 1, k ) );
+		}
+	}
+}
+#endif
+
+TEST( BinomialCoefficient, shouldComputeRowsBeyondTriangle )
+{
+	size_t coefficient;
+
+	EXPECT_TRUE( binomialCoefficient( 1000, 2, coefficient ) );
+	EXPECT_EQ( 499500, coefficient );
+	EXPECT_TRUE( binomialCoefficient( 1000, 1000, coefficient ) );
+	EXPECT_EQ( 1, coefficient );
+	EXPECT_FALSE( binomialCoefficient( 1000, 10, coefficient ) );
+}
+
+int main( int argc, char** argv )
+{
+	::testing::InitGoogleTest( &argc, argv );
+	return RUN_ALL_TESTS();
+}
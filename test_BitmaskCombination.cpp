@@ -0,0 +1,135 @@
+/**
+ * Copyright ©2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "BitmaskCombination.hpp"
+#include "Combination.hpp"
+
+/**
+ * Notes:
+ *   - Requires that gtest is installed on the system.
+ *
+ * To compile the test
+ *     $ g++ test_BitmaskCombination.cpp -L/usr/lib/ -lgtest -lgtest_main -pthread -o test_all
+ *
+ * Then to run the test
+ *     $ ./test_all
+ */
+
+template < typename MaskT >
+static std::vector< size_t > offsetsOf(
+	MaskT mask,
+	size_t numberElements )
+{
+	std::vector< size_t > offsets;
+
+	for ( size_t offset = 0; offset < numberElements; ++offset )
+	{
+		if ( mask & ( MaskT( 1 ) << offset ) )
+		{
+			offsets.push_back( offset );
+		}
+	}
+
+	return offsets;
+}
+
+template < typename MaskT >
+static void expectSameEnumerationAsCombination(
+	size_t numberElements,
+	size_t subsetSize )
+{
+	BitmaskCombination< MaskT > bitmaskCombination( numberElements, subsetSize );
+	Combination combination( numberElements, subsetSize );
+	auto iterator = combination.begin();
+
+	for ( MaskT mask : bitmaskCombination )
+	{
+		ASSERT_NE( iterator, combination.end() );
+		ASSERT_EQ( *iterator, offsetsOf( mask, numberElements ) );
+		++iterator;
+	}
+
+	EXPECT_EQ( iterator, combination.end() );
+}
+
+TEST( BitmaskCombination, DefaultConstructor )
+{
+	BitmaskCombination<> combination;
+
+	EXPECT_EQ( 0, combination.numberElements() );
+	EXPECT_EQ( 0, combination.subsetSize() );
+	EXPECT_EQ( combination.begin(), combination.end() );
+}
+
+TEST( BitmaskCombination, MoveConstructor )
+{
+	BitmaskCombination<> moveCombination( 7, 4 );
+	BitmaskCombination<> defaultCombination( std::move( moveCombination ) );
+
+	EXPECT_EQ( 7, defaultCombination.numberElements() );
+	EXPECT_EQ( 4, defaultCombination.subsetSize() );
+	EXPECT_EQ( 0, moveCombination.numberElements() );
+	EXPECT_EQ( 0, moveCombination.subsetSize() );
+}
+
+TEST( BitmaskCombination, constructorShouldThrowForNumberElementsBeyondWidthOfMask )
+{
+	EXPECT_THROW( BitmaskCombination< uint64_t >( 65, 2 ), std::invalid_argument );
+	EXPECT_THROW( BitmaskCombination< uint8_t >( 9, 2 ), std::invalid_argument );
+}
+
+TEST( BitmaskCombination, beginShouldReturnConstIteratorEqualToEndForNumberElementsLessThanSubsetSize )
+{
+	BitmaskCombination<> combination( 3, 7 );
+
+	EXPECT_EQ( combination.begin(), combination.end() );
+}
+
+TEST( BitmaskCombination, beginShouldReturnConstIteratorEqualToEndForSubsetSizeEqualsZero )
+{
+	BitmaskCombination<> combination( 7, 0 );
+
+	EXPECT_EQ( combination.begin(), combination.end() );
+}
+
+TEST( BitmaskCombination, enumerationShouldMatchCombination )
+{
+	for ( size_t numberElements = 1; numberElements <= 10; ++numberElements )
+	{
+		for ( size_t subsetSize = 1; subsetSize <= numberElements; ++subsetSize )
+		{
+			expectSameEnumerationAsCombination< uint64_t >( numberElements, subsetSize );
+		}
+	}
+}
+
+TEST( BitmaskCombination, enumerationShouldMatchCombinationForFullWidthMask )
+{
+	expectSameEnumerationAsCombination< uint8_t >( 8, 3 );
+	expectSameEnumerationAsCombination< uint8_t >( 8, 8 );
+	expectSameEnumerationAsCombination< uint64_t >( 64, 2 );
+	expectSameEnumerationAsCombination< uint64_t >( 64, 63 );
+}
+
+#if defined( __SIZEOF_INT128__ ) && !defined( COMBINATION_DISABLE_INT128 )
+TEST( BitmaskCombination, enumerationShouldMatchCombinationForInt128Mask )
+{
+	expectSameEnumerationAsCombination< unsigned __int128 >( 100, 2 );
+	expectSameEnumerationAsCombination< unsigned __int128 >( 128, 2 );
+	expectSameEnumerationAsCombination< unsigned __int128 >( 128, 127 );
+}
+#endif
+
+int main( int argc, char** argv )
+{
+	::testing::InitGoogleTest( &argc, argv );
+	return RUN_ALL_TESTS();
+}
@@ -3,9 +3,16 @@
  * Permission to use, copy, modify, and/or distribute this software, in whole
  * or part by any means, without express prior written agreement is prohibited.
  */
+#include <algorithm>
+#include <cstdint>
 #include <gtest/gtest.h>
+#include <iterator>
+#include <type_traits>
+#include <stdexcept>
 #include <utility>
+#include <vector>
 
+#include "AlignedAllocator.hpp"
 #include "Combination.hpp"
 
 /**
@@ -151,6 +158,775 @@ TEST( Combination, subsetSizeShouldReturnSetValueForParameterDefaultConstructor
 	EXPECT_EQ( 4, defaultCombination.subsetSize() );
 }
 
+TEST( CombinationConstIterator, incrementShouldEnumerateAllSubsetsInLexicographicOrder )
+{
+	Combination combination( 5, 3 );
+	std::vector< std::vector< size_t > > expected {
+		{ 0, 1, 2 }, { 0, 1, 3 }, { 0, 1, 4 }, { 0, 2, 3 }, { 0, 2, 4 },
+		{ 0, 3, 4 }, { 1, 2, 3 }, { 1, 2, 4 }, { 1, 3, 4 }, { 2, 3, 4 } };
+	std::vector< std::vector< size_t > > enumerated;
+
+	for ( const auto& subset : combination )
+	{
+		enumerated.push_back( subset );
+	}
+
+	EXPECT_EQ( expected, enumerated );
+}
+
+TEST( CombinationConstIterator, incrementPastLastSubsetShouldCompareEqualToEnd )
+{
+	Combination combination( 7, 4 );
+	auto iterator = combination.begin();
+
+	for ( size_t count = 35; count--; ++iterator )
+	{
+		EXPECT_NE( iterator, combination.end() );
+	}
+
+	EXPECT_EQ( iterator, combination.end() );
+}
+
+TEST( CombinationConstIterator, endShouldNotHoldAnEnumeration )
+{
+	Combination combination( 7, 4 );
+
+	EXPECT_TRUE( combination.end()->empty() );
+}
+
+TEST( CombinationConstIterator, endShouldNotCompareEqualToEndOfDifferentCombination )
+{
+	Combination combination( 7, 4 );
+	Combination otherCombination( 7, 3 );
+
+	EXPECT_NE( combination.end(), otherCombination.end() );
+}
+
+TEST( CombinationConstIterator, narrowSizeTypeShouldEnumerateSameSubsetsAsSizeT )
+{
+	BasicCombination< uint8_t > narrowCombination( 12, 5 );
+	Combination combination( 12, 5 );
+	auto iterator = combination.begin();
+
+	for ( const auto& subset : narrowCombination )
+	{
+		ASSERT_NE( iterator, combination.end() );
+		EXPECT_EQ( *iterator, std::vector< size_t >( subset.begin(), subset.end() ) );
+		++iterator;
+	}
+
+	EXPECT_EQ( iterator, combination.end() );
+}
+
+TEST( Combination, constructorShouldAcceptNumberElementsAtRangeOfSizeType )
+{
+	BasicCombination< uint8_t > combination( 256, 2 );
+	std::vector< uint8_t > last;
+
+	for ( const auto& subset : combination )
+	{
+		last = subset;
+	}
+
+	EXPECT_EQ( ( std::vector< uint8_t > { 254, 255 } ), last );
+}
+
+TEST( Combination, constructorShouldThrowForNumberElementsBeyondRangeOfSizeType )
+{
+	EXPECT_THROW( BasicCombination< uint8_t >( 257, 2 ), std::invalid_argument );
+}
+
+TEST( Combination, sizeShouldReturnNumberOfSubsets )
+{
+	EXPECT_EQ( 35, Combination( 7, 4 ).size() );
+	EXPECT_EQ( 1, Combination( 7, 7 ).size() );
+	EXPECT_EQ( 0, Combination( 7, 0 ).size() );
+	EXPECT_EQ( 0, Combination( 3, 7 ).size() );
+	EXPECT_EQ( 0, Combination().size() );
+}
+
+TEST( Combination, sizeShouldThrowWhenNumberOfSubsetsOverflows )
+{
+	EXPECT_THROW( Combination( 200, 13 ).size(), std::overflow_error );
+}
+
+TEST( Combination, atShouldReturnSubsetAtRank )
+{
+	Combination combination( 9, 4 );
+	size_t rank = 0;
+
+	for ( const auto& subset : combination )
+	{
+		EXPECT_EQ( subset, combination.at( rank++ ) );
+	}
+}
+
+TEST( Combination, atShouldThrowForRankOutsideOfEnumeration )
+{
+	EXPECT_THROW( Combination( 7, 4 ).at( 35 ), std::out_of_range );
+	EXPECT_THROW( Combination( 7, 0 ).at( 0 ), std::out_of_range );
+}
+
+TEST( Combination, rankShouldReturnRankOfSubset )
+{
+	Combination combination( 9, 4 );
+	size_t rank = 0;
+
+	for ( const auto& subset : combination )
+	{
+		EXPECT_EQ( rank++, combination.rank( subset ) );
+	}
+}
+
+TEST( Combination, rankShouldThrowForSubsetOutsideOfEnumeration )
+{
+	Combination combination( 7, 3 );
+
+	EXPECT_THROW( combination.rank( { 0, 1 } ), std::invalid_argument );
+	EXPECT_THROW( combination.rank( { 0, 2, 1 } ), std::invalid_argument );
+	EXPECT_THROW( combination.rank( { 0, 1, 7 } ), std::invalid_argument );
+}
+
+TEST( CombinationConstIterator, differenceFromBeginToEndShouldReturnSize )
+{
+	Combination combination( 12, 5 );
+
+	EXPECT_EQ( 792, combination.end() - combination.begin() );
+	EXPECT_EQ( 792, std::distance( combination.begin(), combination.end() ) );
+}
+
+TEST( CombinationConstIterator, additionShouldMatchRepeatedIncrement )
+{
+	Combination combination( 10, 4 );
+	auto begin = combination.begin();
+	std::ptrdiff_t offset = 0;
+
+	for ( auto iterator = begin; iterator != combination.end(); ++iterator, ++offset )
+	{
+		EXPECT_EQ( iterator, begin + offset );
+		EXPECT_EQ( *iterator, begin[ offset ] );
+		EXPECT_EQ( offset, iterator - begin );
+	}
+
+	EXPECT_EQ( combination.end(), begin + offset );
+	EXPECT_EQ( combination.end(), offset + begin );
+}
+
+TEST( CombinationConstIterator, subtractionShouldMatchRepeatedDecrement )
+{
+	Combination combination( 10, 4 );
+	auto end = combination.end();
+	auto iterator = end;
+
+	for ( std::ptrdiff_t offset = 1; offset <= 210; ++offset )
+	{
+		--iterator;
+		EXPECT_EQ( iterator, end - offset );
+	}
+
+	EXPECT_EQ( combination.begin(), iterator );
+}
+
+TEST( CombinationConstIterator, decrementFromEndShouldReturnLastSubset )
+{
+	Combination combination( 7, 3 );
+	auto iterator = combination.end();
+
+	EXPECT_EQ( ( std::vector< size_t > { 4, 5, 6 } ), *--iterator );
+}
+
+TEST( CombinationConstIterator, additionShouldThrowOutsideOfEnumeration )
+{
+	Combination combination( 7, 4 );
+
+	EXPECT_THROW( combination.begin() + 36, std::out_of_range );
+	EXPECT_THROW( combination.begin() - 1, std::out_of_range );
+}
+
+TEST( CombinationConstIterator, additionByOneShouldThrowFromEnd )
+{
+	Combination combination( 7, 4 );
+	auto iterator = combination.end();
+
+	EXPECT_THROW( iterator += 1, std::out_of_range );
+	EXPECT_THROW( combination.end() + 1, std::out_of_range );
+	EXPECT_THROW( Combination( 3, 0 ).end() += 1, std::out_of_range );
+	EXPECT_EQ( combination.end(), combination.begin() + 34 + 1 );
+}
+
+TEST( CombinationConstIterator, relationalOperatorsShouldFollowLexicographicOrder )
+{
+	Combination combination( 7, 4 );
+	auto first = combination.begin() + 3;
+	auto second = combination.begin() + 20;
+
+	EXPECT_LT( first, second );
+	EXPECT_GT( second, first );
+	EXPECT_LE( first, first );
+	EXPECT_GE( second, second );
+	EXPECT_LT( second, combination.end() );
+	EXPECT_FALSE( combination.end() < combination.end() );
+}
+
+TEST( Combination, sliceShouldEnumerateSubsetsOfRankRange )
+{
+	Combination combination( 9, 4 );
+	auto slice = combination.slice( 17, 40 );
+	size_t rank = 17;
+
+	EXPECT_EQ( 17, slice.firstRank() );
+	EXPECT_EQ( 40, slice.size() );
+
+	for ( const auto& subset : slice )
+	{
+		EXPECT_EQ( combination.at( rank++ ), subset );
+	}
+
+	EXPECT_EQ( 57, rank );
+}
+
+TEST( Combination, sliceToEndOfEnumerationShouldEndAtEnd )
+{
+	Combination combination( 9, 4 );
+	auto slice = combination.slice( 120, 6 );
+
+	EXPECT_EQ( combination.end(), slice.end() );
+	EXPECT_EQ( 6, std::distance( slice.begin(), slice.end() ) );
+}
+
+TEST( Combination, sliceShouldThrowPastEndOfEnumeration )
+{
+	Combination combination( 9, 4 );
+
+	EXPECT_NO_THROW( combination.slice( 126, 0 ) );
+	EXPECT_THROW( combination.slice( 120, 7 ), std::out_of_range );
+	EXPECT_THROW( combination.slice( 127, 0 ), std::out_of_range );
+}
+
+TEST( Combination, splitShouldPartitionEnumerationInOrder )
+{
+	Combination combination( 10, 4 );
+	auto slices = combination.split( 4 );
+	std::vector< std::vector< size_t > > enumerated;
+
+	ASSERT_EQ( 4, slices.size() );
+	EXPECT_EQ( 53, slices[ 0 ].size() );
+	EXPECT_EQ( 53, slices[ 1 ].size() );
+	EXPECT_EQ( 52, slices[ 2 ].size() );
+	EXPECT_EQ( 52, slices[ 3 ].size() );
+
+	for ( const auto& slice : slices )
+	{
+		for ( const auto& subset : slice )
+		{
+			enumerated.push_back( subset );
+		}
+	}
+
+	EXPECT_EQ( std::vector< std::vector< size_t > >( combination.begin(), combination.end() ), enumerated );
+}
+
+TEST( Combination, splitShouldReturnEmptySlicesForMorePartsThanSubsets )
+{
+	Combination combination( 4, 3 );
+	auto slices = combination.split( 6 );
+
+	ASSERT_EQ( 6, slices.size() );
+	EXPECT_EQ( 1, slices[ 3 ].size() );
+	EXPECT_EQ( 0, slices[ 4 ].size() );
+	EXPECT_EQ( slices[ 5 ].begin(), slices[ 5 ].end() );
+}
+
+TEST( Combination, shardShouldMatchSplit )
+{
+	Combination combination( 12, 5 );
+
+	for ( size_t shardCount : { 1, 2, 7, 64, 792, 1000 } )
+	{
+		auto slices = combination.split( shardCount );
+
+		for ( size_t shardIndex = 0; shardIndex < shardCount; ++shardIndex )
+		{
+			auto shard = combination.shard( shardIndex, shardCount );
+
+			ASSERT_EQ( slices[ shardIndex ].firstRank(), shard.firstRank() );
+			ASSERT_EQ( slices[ shardIndex ].size(), shard.size() );
+			ASSERT_EQ( slices[ shardIndex ].begin(), shard.begin() );
+			ASSERT_EQ( slices[ shardIndex ].end(), shard.end() );
+		}
+	}
+}
+
+TEST( Combination, shardsShouldMergeInLexicographicOrder )
+{
+	Combination combination( 20, 6 );
+	std::vector< std::vector< size_t > > merged;
+
+	for ( size_t shardIndex = 0; shardIndex < 9; ++shardIndex )
+	{
+		auto shard = combination.shard( shardIndex, 9 );
+		EXPECT_EQ( combination.at( shard.firstRank() ), *shard.begin() );
+		merged.insert( merged.end(), shard.begin(), shard.end() );
+	}
+
+	EXPECT_EQ( std::vector< std::vector< size_t > >( combination.begin(), combination.end() ), merged );
+	EXPECT_THROW( combination.shard( 9, 9 ), std::invalid_argument );
+	EXPECT_THROW( combination.shard( 0, 0 ), std::invalid_argument );
+}
+
+TEST( CombinationConstIterator, nextBatchShouldWriteSubsetsInEnumerationOrder )
+{
+	Combination combination( 9, 4 );
+	std::vector< size_t > expected;
+
+	for ( const auto& subset : combination )
+	{
+		expected.insert( expected.end(), subset.begin(), subset.end() );
+	}
+
+	for ( size_t maxSubsets : { 1, 3, 5, 17, 126, 200 } )
+	{
+		std::vector< size_t > batches;
+		std::vector< size_t > buffer( maxSubsets * 4 );
+		auto iterator = combination.begin();
+
+		for ( size_t count; 0 != ( count = iterator.nextBatch( buffer.data(), maxSubsets ) ); )
+		{
+			EXPECT_TRUE( ( count == maxSubsets ) or ( iterator == combination.end() ) );
+			batches.insert( batches.end(), buffer.begin(), buffer.begin() + count * 4 );
+		}
+
+		EXPECT_EQ( expected, batches ) << "maxSubsets " << maxSubsets;
+	}
+}
+
+TEST( CombinationConstIterator, nextBatchShouldAdvancePastWrittenSubsets )
+{
+	Combination combination( 9, 4 );
+	std::vector< size_t > buffer( 10 * 4 );
+	auto iterator = combination.begin() + 3;
+
+	EXPECT_EQ( 10, iterator.nextBatch( buffer.data(), 10 ) );
+	EXPECT_EQ( combination.begin() + 13, iterator );
+	EXPECT_EQ( combination.at( 3 ), std::vector< size_t >( buffer.begin(), buffer.begin() + 4 ) );
+}
+
+TEST( CombinationConstIterator, nextBatchShouldWriteNothingAtEnd )
+{
+	Combination combination( 3, 7 );
+	std::vector< size_t > buffer( 7 );
+
+	EXPECT_EQ( 0, combination.begin().nextBatch( buffer.data(), 1 ) );
+}
+
+TEST( CombinationConstIterator, nextBatchColumnsShouldWriteTransposedSubsets )
+{
+	using Allocator = AlignedAllocator< uint16_t, 64 >;
+	BasicCombination< uint16_t > combination( 11, 4 );
+	size_t columnStride = Allocator::paddedSize( 37 );
+	std::vector< uint16_t, Allocator > columns( columnStride * 4 );
+	auto iterator = combination.begin();
+	size_t rank = 0;
+
+	EXPECT_EQ( 0, columnStride % 32 );
+
+	for ( size_t count; 0 != ( count = iterator.nextBatchColumns( columns.data(), 37, columnStride ) ); rank += count )
+	{
+		for ( size_t subset = 0; subset < count; ++subset )
+		{
+			auto expected = combination.at( rank + subset );
+
+			for ( size_t index = 0; index < 4; ++index )
+			{
+				ASSERT_EQ( expected[ index ], columns[ index * columnStride + subset ] );
+			}
+		}
+	}
+
+	EXPECT_EQ( combination.size(), rank );
+}
+
+TEST( CombinationConstIterator, nextBatchColumnsShouldMatchNextBatch )
+{
+	Combination combination( 8, 3 );
+	std::vector< size_t > rows( 20 * 3 );
+	std::vector< size_t > columns( 20 * 3 );
+	auto rowIterator = combination.begin();
+	auto columnIterator = combination.begin();
+
+	for ( size_t count; 0 != ( count = rowIterator.nextBatch( rows.data(), 20 ) ); )
+	{
+		ASSERT_EQ( count, columnIterator.nextBatchColumns( columns.data(), 20 ) );
+
+		for ( size_t subset = 0; subset < count; ++subset )
+		{
+			for ( size_t index = 0; index < 3; ++index )
+			{
+				ASSERT_EQ( rows[ subset * 3 + index ], columns[ index * 20 + subset ] );
+			}
+		}
+	}
+
+	EXPECT_EQ( combination.end(), columnIterator );
+}
+
+TEST( CombinationConstIterator, changedFromShouldReturnLowestModifiedPosition )
+{
+	Combination combination( 9, 4 );
+	auto iterator = combination.begin();
+	std::vector< size_t > previous = *iterator;
+
+	EXPECT_EQ( 0, iterator.changedFrom() );
+
+	for ( ++iterator; iterator != combination.end(); ++iterator )
+	{
+		size_t changedFrom = iterator.changedFrom();
+
+		ASSERT_LT( changedFrom, 4 );
+		EXPECT_TRUE( std::equal( previous.begin(), previous.begin() + changedFrom, iterator->begin() ) );
+		EXPECT_NE( previous[ changedFrom ], ( *iterator )[ changedFrom ] );
+		previous = *iterator;
+	}
+}
+
+TEST( CombinationConstIterator, changedFromShouldReturnLowestModifiedPositionAfterDecrement )
+{
+	Combination combination( 9, 4 );
+	auto iterator = combination.begin() + 10;
+	std::vector< size_t > previous = *iterator;
+
+	--iterator;
+
+	EXPECT_TRUE( std::equal( previous.begin(), previous.begin() + iterator.changedFrom(), iterator->begin() ) );
+	EXPECT_NE( previous[ iterator.changedFrom() ], ( *iterator )[ iterator.changedFrom() ] );
+}
+
+TEST( CombinationConstIterator, changedFromShouldReturnZeroAfterJump )
+{
+	Combination combination( 9, 4 );
+	auto iterator = combination.begin();
+
+	++iterator;
+	EXPECT_EQ( 3, iterator.changedFrom() );
+
+	iterator += 5;
+	EXPECT_EQ( 0, iterator.changedFrom() );
+}
+
+TEST( CombinationConstIterator, changedFromShouldCoverWholeBatch )
+{
+	Combination combination( 9, 4 );
+	std::vector< size_t > buffer( 3 * 4 );
+	auto iterator = combination.begin();
+
+	iterator.nextBatch( buffer.data(), 3 );
+	EXPECT_EQ( 3, iterator.changedFrom() );
+
+	iterator.nextBatch( buffer.data(), 3 );
+	EXPECT_EQ( 2, iterator.changedFrom() );
+}
+
+TEST( CombinationConstIterator, emptyBatchShouldLeaveChangedFromAlone )
+{
+	Combination combination( 9, 4 );
+	std::vector< size_t > buffer( 4 );
+	auto iterator = combination.begin();
+
+	EXPECT_EQ( 0, iterator.nextBatch( buffer.data(), 0 ) );
+	EXPECT_EQ( 0, iterator.changedFrom() );
+	EXPECT_EQ( 0, iterator.nextBatchColumns( buffer.data(), 0 ) );
+	EXPECT_EQ( 0, iterator.changedFrom() );
+	EXPECT_EQ( combination.begin(), iterator );
+
+	++iterator;
+	EXPECT_EQ( 0, iterator.nextBatch( buffer.data(), 0 ) );
+	EXPECT_EQ( 3, iterator.changedFrom() );
+}
+
+TEST( CombinationConstIterator, skipPrefixShouldMoveToNextSubsetWithDifferentPrefix )
+{
+	Combination combination( 9, 4 );
+
+	for ( size_t depth = 1; depth <= 4; ++depth )
+	{
+		auto iterator = combination.begin();
+		auto expected = combination.begin();
+
+		while ( iterator != combination.end() )
+		{
+			std::vector< size_t > prefix( iterator->begin(), iterator->begin() + depth );
+
+			for ( ; ( expected != combination.end() )
+				and std::equal( prefix.begin(), prefix.end(), expected->begin() ); ++expected );
+
+			iterator.skipPrefix( depth );
+			ASSERT_EQ( expected, iterator );
+		}
+	}
+}
+
+TEST( CombinationConstIterator, skipPrefixShouldReportChangedPosition )
+{
+	Combination combination( 9, 4 );
+	auto iterator = combination.begin();
+
+	iterator.skipPrefix( 2 );
+
+	EXPECT_EQ( ( std::vector< size_t > { 0, 2, 3, 4 } ), *iterator );
+	EXPECT_EQ( 1, iterator.changedFrom() );
+}
+
+TEST( CombinationConstIterator, skipPrefixOfZeroShouldMoveToEnd )
+{
+	Combination combination( 9, 4 );
+	auto iterator = combination.begin() + 7;
+
+	EXPECT_EQ( combination.end(), iterator.skipPrefix( 0 ) );
+}
+
+TEST( CombinationConstIterator, skipPrefixBeyondSubsetSizeShouldIncrement )
+{
+	Combination combination( 9, 4 );
+	auto iterator = combination.begin() + 7;
+
+	EXPECT_EQ( combination.begin() + 8, iterator.skipPrefix( 10 ) );
+}
+
+TEST( CombinationConstIterator, valueTypeShouldBeNonConstVector )
+{
+	static_assert( std::is_same< std::iterator_traits< Combination::const_iterator >::value_type, std::vector< size_t > >::value,
+		"value_type must be the unqualified subset type" );
+	static_assert( std::is_same< decltype( Combination( 5, 2 ).begin()[ 3 ] ), std::vector< size_t > >::value,
+		"subscript must return a copy" );
+	static_assert( std::is_same< std::iterator_traits< Combination::const_iterator >::iterator_category,
+		std::forward_iterator_tag >::value, "the iterator refers into itself, so it is only a forward iterator" );
+
+	Combination combination( 6, 3 );
+	auto iterator = combination.begin();
+
+	EXPECT_EQ( combination.at( 7 ), iterator[ 7 ] );
+	EXPECT_EQ( combination.at( 0 ), *iterator );
+}
+
+TEST( CombinationConstIterator, subscriptsShouldNotAlias )
+{
+	Combination combination( 6, 3 );
+	auto iterator = combination.begin();
+	const auto& first = iterator[ 1 ];
+	const auto& second = iterator[ 2 ];
+
+	EXPECT_NE( iterator[ 1 ], iterator[ 2 ] );
+	EXPECT_EQ( combination.at( 1 ), first );
+	EXPECT_EQ( combination.at( 2 ), second );
+}
+
+TEST( CombinationConstIterator, decrementShouldWalkTheEnumerationBackward )
+{
+	// The backward walk takes the place of std::reverse_iterator, which would
+	// dereference a temporary copy of the iterator.
+	Combination combination( 5, 2 );
+	std::vector< std::vector< size_t > > forward( combination.begin(), combination.end() );
+	std::vector< std::vector< size_t > > backward;
+
+	for ( auto iterator = combination.end(); iterator != combination.begin(); )
+	{
+		--iterator;
+		backward.push_back( *iterator );
+	}
+
+	EXPECT_EQ( std::vector< std::vector< size_t > >( forward.rbegin(), forward.rend() ), backward );
+}
+
+TEST( CombinationConstIterator, swapShouldExchangeEndFlags )
+{
+	Combination combination( 6, 3 );
+	auto first = combination.begin();
+	auto last = combination.end();
+
+	first.swap( last );
+
+	EXPECT_EQ( combination.end(), first );
+	EXPECT_EQ( combination.begin(), last );
+	EXPECT_EQ( ( std::vector< size_t > { 0, 1, 2 } ), *last );
+}
+
+TEST( Combination, dropShouldSkipLeadingSubsetsByUnranking )
+{
+	Combination combination( 9, 4 );
+	auto dropped = combination.drop( 100 );
+
+	EXPECT_EQ( 100, dropped.firstRank() );
+	EXPECT_EQ( 26, dropped.size() );
+	EXPECT_EQ( combination.at( 100 ), *dropped.begin() );
+	EXPECT_EQ( combination.end(), dropped.end() );
+	EXPECT_EQ( 0, combination.drop( 1000 ).size() );
+}
+
+TEST( CombinationConstIterator, resumeShouldRestoreSavedPosition )
+{
+	for ( size_t numberElements = 0; numberElements <= 8; ++numberElements )
+	{
+		for ( size_t subsetSize = 0; subsetSize <= numberElements + 1; ++subsetSize )
+		{
+			BasicCombination< uint8_t > combination( numberElements, subsetSize );
+			uint64_t rank = 0;
+
+			for ( auto iterator = combination.begin(); ; ++iterator, ++rank )
+			{
+				CombinationCheckpoint checkpoint = iterator.save();
+
+				ASSERT_EQ( CombinationCheckpoint( numberElements, subsetSize, rank ), checkpoint );
+				ASSERT_EQ( iterator, BasicCombination< uint8_t >::const_iterator::resume( checkpoint ) );
+
+				if ( iterator == combination.end() )
+				{
+					break;
+				}
+			}
+		}
+	}
+}
+
+TEST( CombinationConstIterator, resumeShouldContinueEnumeration )
+{
+	Combination combination( 40, 6 );
+	auto iterator = combination.begin() + 1234567;
+	auto bytes = iterator.save().serialize();
+	auto resumed = Combination::const_iterator::resume( CombinationCheckpoint::deserialize( bytes.data(), bytes.size() ) );
+
+	EXPECT_GE( 6, bytes.size() );
+
+	for ( size_t step = 0; step < 1000; ++step, ++iterator, ++resumed )
+	{
+		ASSERT_EQ( *iterator, *resumed );
+	}
+}
+
+TEST( CombinationConstIterator, resumeShouldRejectInvalidCheckpoints )
+{
+	EXPECT_THROW( Combination::const_iterator::resume( CombinationCheckpoint( 6, 3, 21 ) ), std::out_of_range );
+	EXPECT_THROW( BasicCombination< uint8_t >::const_iterator::resume( CombinationCheckpoint( 257, 2, 0 ) ), std::invalid_argument );
+	EXPECT_THROW( Combination::const_iterator::resume( CombinationCheckpoint( 200, 100, 0 ) ), std::overflow_error );
+	EXPECT_EQ( Combination( 6, 3 ).end(), Combination::const_iterator::resume( CombinationCheckpoint( 6, 3, 20 ) ) );
+}
+
+TEST( CombinationCheckpoint, serializeShouldRoundTrip )
+{
+	for ( const auto& checkpoint : std::vector< CombinationCheckpoint > {
+		CombinationCheckpoint(),
+		CombinationCheckpoint( 127, 128, 16383 ),
+		CombinationCheckpoint( 64, 32, 1832624140942590533ull ),
+		CombinationCheckpoint( ~0ull, ~0ull, ~0ull ) } )
+	{
+		auto bytes = checkpoint.serialize();
+
+		ASSERT_EQ( checkpoint, CombinationCheckpoint::deserialize( bytes.data(), bytes.size() ) );
+	}
+
+	EXPECT_EQ( 3, CombinationCheckpoint().serialize().size() );
+	EXPECT_EQ( 5, CombinationCheckpoint( 127, 128, 16383 ).serialize().size() );
+	EXPECT_EQ( 30, CombinationCheckpoint( ~0ull, ~0ull, ~0ull ).serialize().size() );
+}
+
+TEST( CombinationCheckpoint, deserializeShouldRejectMalformedBytes )
+{
+	auto bytes = CombinationCheckpoint( 300, 3, 70000 ).serialize();
+	std::vector< uint8_t > trailing( bytes );
+	trailing.push_back( 0 );
+	std::vector< uint8_t > wide( 10, 0xFF );
+	wide.back() = 0x02;
+	wide.push_back( 0 );
+	wide.push_back( 0 );
+
+	EXPECT_THROW( CombinationCheckpoint::deserialize( bytes.data(), bytes.size() - 1 ), std::invalid_argument );
+	EXPECT_THROW( CombinationCheckpoint::deserialize( trailing.data(), trailing.size() ), std::invalid_argument );
+	EXPECT_THROW( CombinationCheckpoint::deserialize( wide.data(), wide.size() ), std::invalid_argument );
+}
+
+TEST( Combination, atShouldUnrankLargeEnumerations )
+{
+	Combination combination( 64, 32 );
+	size_t total = combination.size();
+
+	for ( size_t rank : { size_t( 0 ), size_t( 1 ), total / 3, total / 2, total - 2, total - 1 } )
+	{
+		ASSERT_EQ( rank, combination.rank( combination.at( rank ) ) );
+	}
+
+	EXPECT_EQ( ( std::vector< size_t > { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+		16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 32 } ), combination.at( 1 ) );
+}
+
+#if defined( __cpp_lib_ranges )
+template < typename Range >
+concept Reversible = requires( Range range ) { range | std::views::reverse; };
+
+TEST( Combination, shouldModelForwardView )
+{
+	static_assert( std::forward_iterator< Combination::const_iterator > );
+	static_assert( not std::bidirectional_iterator< Combination::const_iterator > );
+	static_assert( std::ranges::forward_range< Combination > );
+	static_assert( not Reversible< Combination > );
+	static_assert( not Reversible< Slice< Combination::const_iterator > > );
+	static_assert( std::ranges::sized_range< Combination > );
+	static_assert( std::ranges::view< Combination > );
+	static_assert( std::ranges::borrowed_range< Combination > );
+	static_assert( std::ranges::borrowed_range< Slice< Combination::const_iterator > > );
+
+	Combination combination( 10, 3 );
+	auto pipeline = combination
+		| std::views::filter( []( const std::vector< size_t >& subset ) { return 0 == ( subset[ 0 ] + subset[ 1 ] + subset[ 2 ] ) % 5; } )
+		| std::views::drop( 2 )
+		| std::views::take( 3 );
+	std::vector< std::vector< size_t > > expected;
+
+	for ( const auto& subset : combination )
+	{
+		if ( 0 == ( subset[ 0 ] + subset[ 1 ] + subset[ 2 ] ) % 5 )
+		{
+			expected.push_back( subset );
+		}
+	}
+
+	expected = std::vector< std::vector< size_t > >( expected.begin() + 2, expected.begin() + 5 );
+	std::vector< std::vector< size_t > > piped;
+
+	for ( const auto& subset : pipeline )
+	{
+		piped.push_back( subset );
+	}
+
+	EXPECT_EQ( expected, piped );
+	EXPECT_EQ( combination.at( 50 ), *std::ranges::begin( combination | std::views::drop( 50 ) ) );
+}
+#endif
+
+#if defined( __cpp_lib_generator )
+TEST( Combination, generateShouldYieldEverySubset )
+{
+	Combination combination( 7, 3 );
+	std::vector< std::vector< size_t > > generated;
+
+	for ( const auto& subset : combination.generate() )
+	{
+		generated.push_back( subset );
+	}
+
+	EXPECT_EQ( std::vector< std::vector< size_t > >( combination.begin(), combination.end() ), generated );
+
+	// The generator keeps its own copy, so it outlives a temporary combination.
+	auto generator = Combination( 7, 3 ).generate();
+	generated.clear();
+
+	for ( const auto& subset : generator )
+	{
+		generated.push_back( subset );
+	}
+
+	EXPECT_EQ( std::vector< std::vector< size_t > >( combination.begin(), combination.end() ), generated );
+}
+#endif
+
 int main( int argc, char** argv )
 {
 	::testing::InitGoogleTest( &argc, argv );
@@ -0,0 +1,140 @@
+/**
+ * Copyright ©2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#include <algorithm>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "BinomialCoefficient.hpp"
+#include "Combination.hpp"
+#include "CombinationKernel.hpp"
+
+/**
+ * Notes:
+ *   - Requires that gtest is installed on the system.
+ *
+ * To compile the test
+ *     $ g++ test_CombinationKernel.cpp -L/usr/lib/ -lgtest -lgtest_main -pthread -o test_all
+ *
+ * Then to run the test
+ *     $ ./test_all
+ */
+
+TEST( CombinationKernel, combinationCountShouldMatchCombinationSize )
+{
+	for ( uint64_t n = 0; n <= 70; ++n )
+	{
+		for ( uint64_t k = 0; k <= n + 1; ++k )
+		{
+			size_t expected = 0;
+			uint64_t count = 1;
+			bool fits = ( 0 == k ) or ( n < k ) or binomialCoefficient( n, k, expected );
+
+			ASSERT_EQ( fits, combinationCount( n, k, count ) );
+
+			if ( fits )
+			{
+				ASSERT_EQ( expected, count );
+			}
+		}
+	}
+}
+
+TEST( CombinationKernel, unrankShouldMatchIterator )
+{
+	for ( size_t n = 1; n <= 12; ++n )
+	{
+		for ( size_t k = 1; k <= n; ++k )
+		{
+			BasicCombination< uint8_t > combination( n, k );
+			std::vector< uint8_t > subset( k );
+			uint64_t rank = 0;
+
+			for ( const auto& expected : combination )
+			{
+				ASSERT_TRUE( unrankCombination( n, k, rank++, subset.data() ) );
+				ASSERT_EQ( expected, subset );
+			}
+
+			ASSERT_FALSE( unrankCombination( n, k, rank, subset.data() ) );
+		}
+	}
+}
+
+TEST( CombinationKernel, nextShouldMatchIterator )
+{
+	Combination combination( 14, 5 );
+	std::vector< size_t > subset = { 0, 1, 2, 3, 4 };
+	size_t steps = 0;
+
+	for ( auto iterator = combination.begin(); ++iterator != combination.end(); ++steps )
+	{
+		ASSERT_TRUE( nextCombination( 14, 5, subset.data() ) );
+		ASSERT_EQ( *iterator, subset );
+	}
+
+	EXPECT_EQ( combination.size() - 1, steps );
+	EXPECT_FALSE( nextCombination( 14, 5, subset.data() ) );
+	EXPECT_EQ( std::vector< size_t >( { 9, 10, 11, 12, 13 } ), subset );
+}
+
+TEST( CombinationKernel, unrankShouldHandleCoefficientsNearTheLimit )
+{
+	// C(67, 33) is within a factor of two of the largest uint64_t.
+	Combination combination( 67, 33 );
+	std::vector< uint16_t > subset( 33 );
+
+	for ( size_t rank : { size_t( 0 ), size_t( 12345678901234567ull ), combination.size() - 1 } )
+	{
+		std::vector< size_t > expected = combination.at( rank );
+		ASSERT_TRUE( unrankCombination( 67, 33, rank, subset.data() ) );
+		ASSERT_TRUE( std::equal( expected.begin(), expected.end(), subset.begin() ) );
+	}
+
+	EXPECT_FALSE( nextCombination( 67, 33, subset.data() ) );
+	EXPECT_FALSE( unrankCombination( 68, 34, 0, subset.data() ) );
+}
+
+TEST( CombinationKernel, unrankShouldRejectEmptyEnumerations )
+{
+	uint32_t subset[ 4 ] = { 7, 7, 7, 7 };
+
+	EXPECT_FALSE( unrankCombination( 3, 4, 0, subset ) );
+	EXPECT_FALSE( unrankCombination( 3, 0, 0, subset ) );
+	EXPECT_FALSE( unrankCombination( 0, 0, 0, subset ) );
+	EXPECT_EQ( 7u, subset[ 0 ] );
+}
+
+TEST( CombinationKernel, threadsShouldCoverRangesFromTheirOwnRanks )
+{
+	// Each simulated device thread unranks the start of its range and steps.
+	Combination combination( 20, 4 );
+	uint64_t total = combination.size();
+	uint64_t perThread = 97;
+	std::vector< std::vector< size_t > > subsets;
+
+	for ( uint64_t thread = 0; thread * perThread < total; ++thread )
+	{
+		size_t subset[ 4 ];
+		ASSERT_TRUE( unrankCombination( 20, 4, thread * perThread, subset ) );
+		uint64_t step = 0;
+
+		do
+		{
+			subsets.emplace_back( subset, subset + 4 );
+		}
+		while ( ( ++step < perThread ) and nextCombination( 20, 4, subset ) );
+	}
+
+	ASSERT_EQ( total, subsets.size() );
+	EXPECT_TRUE( std::equal( combination.begin(), combination.end(), subsets.begin() ) );
+}
+
+int main( int argc, char** argv )
+{
+	::testing::InitGoogleTest( &argc, argv );
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,157 @@
+/**
+ * Copyright ©2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <set>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "Combination.hpp"
+#include "CombinationPermutation.hpp"
+#include "ParallelForEach.hpp"
+#include "Permutation.hpp"
+
+/**
+ * Notes:
+ *   - Requires that gtest is installed on the system.
+ *
+ * To compile the test
+ *     $ g++ test_CombinationPermutation.cpp -L/usr/lib/ -lgtest -lgtest_main -pthread -o test_all
+ *
+ * Then to run the test
+ *     $ ./test_all
+ */
+
+TEST( CombinationPermutation, DefaultConstructor )
+{
+	CombinationPermutation<> combination;
+
+	EXPECT_EQ( 0, combination.numberElements() );
+	EXPECT_EQ( 0, combination.subsetSize() );
+	EXPECT_EQ( 0, combination.size() );
+	EXPECT_EQ( combination.begin(), combination.end() );
+}
+
+TEST( CombinationPermutation, MoveConstructor )
+{
+	CombinationPermutation<> moveCombination( 7, 4 );
+	CombinationPermutation<> defaultCombination( std::move( moveCombination ) );
+
+	EXPECT_EQ( 7, defaultCombination.numberElements() );
+	EXPECT_EQ( 4, defaultCombination.subsetSize() );
+	EXPECT_EQ( 0, moveCombination.numberElements() );
+	EXPECT_EQ( 0, moveCombination.subsetSize() );
+}
+
+TEST( CombinationPermutation, constructorShouldThrowForNumberElementsBeyondRangeOfSizeType )
+{
+	EXPECT_THROW( CombinationPermutation< uint8_t >( 257, 2 ), std::invalid_argument );
+}
+
+TEST( CombinationPermutation, enumerationShouldMatchNextPermutationOfEachSubset )
+{
+	for ( size_t numberElements = 0; numberElements <= 7; ++numberElements )
+	{
+		for ( size_t subsetSize = 0; subsetSize <= numberElements + 1; ++subsetSize )
+		{
+			std::vector< std::vector< size_t > > expected;
+
+			for ( auto subset : Combination( numberElements, subsetSize ) )
+			{
+				do
+				{
+					expected.emplace_back( subset.begin(), subset.end() );
+				} while ( std::next_permutation( subset.begin(), subset.end() ) );
+			}
+
+			CombinationPermutation<> combination( numberElements, subsetSize );
+			std::vector< std::vector< size_t > > enumerated( combination.begin(), combination.end() );
+
+			ASSERT_EQ( expected, enumerated ) << numberElements << " permute " << subsetSize;
+			EXPECT_EQ( expected.size(), combination.size() );
+		}
+	}
+}
+
+TEST( CombinationPermutation, enumerationShouldCoverSameSelectionsAsPermutation )
+{
+	CombinationPermutation<> combination( 7, 3 );
+	Permutation<> permutation( 7, 3 );
+	std::set< std::vector< size_t > > fused( combination.begin(), combination.end() );
+	std::set< std::vector< size_t > > ordered( permutation.begin(), permutation.end() );
+
+	EXPECT_EQ( ordered, fused );
+}
+
+TEST( CombinationPermutation, atAndRankShouldBeInverses )
+{
+	CombinationPermutation<> combination( 6, 3 );
+	size_t rank = 0;
+
+	for ( const auto& ordering : combination )
+	{
+		ASSERT_EQ( ordering, combination.at( rank ) );
+		ASSERT_EQ( rank, combination.rank( ordering ) );
+		++rank;
+	}
+
+	EXPECT_THROW( combination.at( rank ), std::out_of_range );
+	EXPECT_THROW( combination.rank( { 1, 1, 2 } ), std::invalid_argument );
+	EXPECT_THROW( combination.rank( { 0, 1 } ), std::invalid_argument );
+}
+
+TEST( CombinationPermutation, iterationShouldNotNeedTheOrderingsToFitInASizeT )
+{
+	// 21! exceeds a size_t, as does 100 choose 20.
+	CombinationPermutation<> allOrderings( 21, 21 );
+	auto iterator = allOrderings.begin();
+	std::vector< size_t > expected( 21 );
+	std::iota( expected.begin(), expected.end(), size_t( 0 ) );
+
+	for ( size_t step = 0; step < 1000; ++step, ++iterator )
+	{
+		ASSERT_NE( allOrderings.end(), iterator );
+		ASSERT_EQ( expected, *iterator );
+		std::next_permutation( expected.begin(), expected.end() );
+	}
+
+	EXPECT_THROW( allOrderings.size(), std::overflow_error );
+
+	CombinationPermutation<> manySubsets( 100, 20 );
+	iterator = manySubsets.begin();
+	expected.resize( 20 );
+	std::iota( expected.begin(), expected.end(), size_t( 0 ) );
+
+	EXPECT_EQ( expected, *iterator );
+	std::next_permutation( expected.begin(), expected.end() );
+	EXPECT_EQ( expected, *( ++iterator ) );
+	EXPECT_THROW( manySubsets.size(), std::overflow_error );
+}
+
+TEST( CombinationPermutation, parallelForEachShouldVisitEveryOrdering )
+{
+	CombinationPermutation<> combination( 8, 4 );
+	std::atomic< size_t > count( 0 );
+	std::atomic< size_t > sum( 0 );
+
+	parallelForEach( combination, [ & ]( const std::vector< size_t >& ordering ) {
+		++count;
+		sum += ordering[ 0 ]; }, 4, 32 );
+
+	// Every offset leads 1 / N of the orderings.
+	EXPECT_EQ( 1680, count.load() );
+	EXPECT_EQ( 210 * ( 0 + 1 + 2 + 3 + 4 + 5 + 6 + 7 ), sum.load() );
+}
+
+int main( int argc, char** argv )
+{
+	::testing::InitGoogleTest( &argc, argv );
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,218 @@
+/**
+ * Copyright ©2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "Combination.hpp"
+#include "CombinationReader.hpp"
+#include "CombinationWriter.hpp"
+
+/**
+ * Notes:
+ *   - Requires that gtest is installed on the system.
+ *
+ * To compile the test
+ *     $ g++ test_CombinationReader.cpp -L/usr/lib/ -lgtest -lgtest_main -pthread -o test_all
+ *
+ * Then to run the test
+ *     $ ./test_all
+ */
+
+static std::vector< uint8_t > pack(
+	const Combination& combination,
+	CombinationFormat format )
+{
+	std::ostringstream stream;
+	CombinationWriter writer( stream, combination.numberElements(), combination.subsetSize(), format );
+	writer.write( combination.begin(), combination.end() );
+	writer.flush();
+
+	std::string bytes = stream.str();
+	return std::vector< uint8_t >( bytes.begin(), bytes.end() );
+}
+
+TEST( CombinationReader, shouldReplayEveryFormat )
+{
+	for ( auto format : { CombinationFormat::Indices, CombinationFormat::Bitmask, CombinationFormat::Delta } )
+	{
+		for ( size_t numberElements = 1; numberElements <= 11; ++numberElements )
+		{
+			for ( size_t subsetSize = 1; subsetSize <= numberElements; ++subsetSize )
+			{
+				Combination combination( numberElements, subsetSize );
+				auto bytes = pack( combination, format );
+				CombinationReader reader( bytes.data(), bytes.size() );
+
+				ASSERT_EQ( format, reader.format() );
+				ASSERT_EQ( numberElements, reader.numberElements() );
+				ASSERT_EQ( subsetSize, reader.subsetSize() );
+				ASSERT_EQ( combination.size(), reader.size() );
+				ASSERT_EQ( std::vector< std::vector< size_t > >( combination.begin(), combination.end() ),
+					std::vector< std::vector< size_t > >( reader.begin(), reader.end() ) );
+			}
+		}
+	}
+}
+
+TEST( CombinationReader, shouldReplayEmptyEnumeration )
+{
+	for ( auto format : { CombinationFormat::Indices, CombinationFormat::Bitmask, CombinationFormat::Delta } )
+	{
+		for ( auto combination : { Combination( 3, 5 ), Combination( 3, 0 ), Combination( 0, 0 ) } )
+		{
+			auto bytes = pack( combination, format );
+			CombinationReader reader( bytes.data(), bytes.size() );
+
+			ASSERT_EQ( size_t( CombinationFileHeader::Size ), bytes.size() );
+			ASSERT_EQ( combination.numberElements(), reader.numberElements() );
+			ASSERT_EQ( combination.subsetSize(), reader.subsetSize() );
+			ASSERT_EQ( 0, reader.size() );
+			ASSERT_EQ( reader.end(), reader.begin() );
+		}
+	}
+}
+
+TEST( CombinationReader, seekShouldMatchUnranking )
+{
+	Combination combination( 24, 5 );
+
+	for ( auto format : { CombinationFormat::Indices, CombinationFormat::Bitmask, CombinationFormat::Delta } )
+	{
+		auto bytes = pack( combination, format );
+		CombinationReader reader( bytes.data(), bytes.size() );
+
+		for ( size_t index : { 0, 1, 255, 256, 257, 10000, 42503 } )
+		{
+			ASSERT_EQ( combination.at( index ), reader.at( index ) );
+
+			auto iterator = reader.seek( index );
+			auto expected = combination.begin() + index;
+
+			for ( size_t step = 0; ( step < 300 ) and ( iterator != reader.end() ); ++step, ++iterator, ++expected )
+			{
+				ASSERT_EQ( *expected, *iterator );
+			}
+		}
+
+		EXPECT_EQ( reader.end(), reader.seek( reader.size() ) );
+		EXPECT_THROW( reader.at( reader.size() ), std::out_of_range );
+		EXPECT_THROW( reader.seek( reader.size() + 1 ), std::out_of_range );
+	}
+}
+
+TEST( CombinationReader, deltaShouldBeSmallerThanIndices )
+{
+	Combination combination( 40, 5 );
+
+	EXPECT_GT( pack( combination, CombinationFormat::Indices ).size() / 2,
+		pack( combination, CombinationFormat::Delta ).size() );
+	EXPECT_EQ( CombinationFileHeader::Size + 5 * combination.size(), pack( combination, CombinationFormat::Bitmask ).size() );
+}
+
+TEST( CombinationReader, shouldReportFirstRankOfShard )
+{
+	Combination combination( 16, 4 );
+	auto shard = combination.shard( 2, 3 );
+	std::ostringstream stream;
+
+	{
+		CombinationWriter writer( stream, 16, 4, CombinationFormat::Delta, shard.firstRank() );
+		writer.write( shard.begin(), shard.end() );
+	}
+
+	std::string bytes = stream.str();
+	CombinationReader reader( reinterpret_cast< const uint8_t* >( bytes.data() ), bytes.size() );
+
+	EXPECT_EQ( shard.firstRank(), reader.firstRank() );
+	EXPECT_EQ( shard.size(), reader.size() );
+	EXPECT_EQ( combination.at( shard.firstRank() + 7 ), reader.at( 7 ) );
+}
+
+TEST( CombinationReader, constructorShouldRejectMalformedData )
+{
+	auto indices = pack( Combination( 6, 3 ), CombinationFormat::Indices );
+	auto bitmask = pack( Combination( 6, 3 ), CombinationFormat::Bitmask );
+	auto delta = pack( Combination( 6, 3 ), CombinationFormat::Delta );
+
+	EXPECT_THROW( CombinationReader( indices.data(), CombinationFileHeader::Size - 1 ), std::invalid_argument );
+	EXPECT_THROW( CombinationReader( indices.data(), indices.size() - 1 ), std::invalid_argument );
+	EXPECT_THROW( CombinationReader( delta.data(), delta.size() - 1 ), std::invalid_argument );
+
+	indices[ 4 ] = CombinationFileHeader::Version + 1;
+	EXPECT_THROW( CombinationReader( indices.data(), indices.size() ), std::invalid_argument );
+
+	delta[ CombinationFileHeader::Size + 4 ] = 9;
+	EXPECT_THROW( CombinationReader( delta.data(), delta.size() ), std::invalid_argument );
+
+	bitmask[ CombinationFileHeader::Size ] = 0x47;
+	CombinationReader reader( bitmask.data(), bitmask.size() );
+	EXPECT_THROW( reader.at( 0 ), std::invalid_argument );
+	EXPECT_EQ( ( std::vector< size_t > { 0, 1, 3 } ), reader.at( 1 ) );
+
+	// Records after a header choosing more than N, or more offsets than the
+	// data could hold, are rejected before anything is sized by K.
+	std::vector< uint8_t > header( CombinationFileHeader::Size + 1, 0 );
+	CombinationFileHeader( 6, 7, CombinationFormat::Indices ).encode( header.data() );
+	EXPECT_THROW( CombinationReader( header.data(), header.size() ), std::invalid_argument );
+
+	CombinationFileHeader( uint64_t( 1 ) << 41, uint64_t( 1 ) << 40, CombinationFormat::Delta ).encode( header.data() );
+	EXPECT_THROW( CombinationReader( header.data(), header.size() ), std::invalid_argument );
+
+	CombinationFileHeader( uint64_t( 1 ) << 63, uint64_t( 1 ) << 62, CombinationFormat::Indices ).encode( header.data() );
+	EXPECT_THROW( CombinationReader( header.data(), header.size() ), std::invalid_argument );
+
+	// Indices records out of range or out of order.
+	std::vector< uint8_t > records( CombinationFileHeader::Size + 6 );
+	CombinationFileHeader( 5, 2, CombinationFormat::Indices ).encode( records.data() );
+	uint8_t offsets[] = { 9, 3, 3, 1, 0, 4 };
+	std::copy( offsets, offsets + 6, records.begin() + CombinationFileHeader::Size );
+	CombinationReader indicesReader( records.data(), records.size() );
+	EXPECT_THROW( indicesReader.at( 0 ), std::invalid_argument );
+	EXPECT_THROW( indicesReader.at( 1 ), std::invalid_argument );
+	EXPECT_EQ( ( std::vector< size_t > { 0, 4 } ), indicesReader.at( 2 ) );
+}
+
+#if defined( __unix__ ) || defined( __APPLE__ )
+TEST( CombinationReader, shouldReadMappedFile )
+{
+	Combination combination( 20, 7 );
+	std::string path = testing::TempDir() + "test_CombinationReader.cmb";
+
+	{
+		std::ofstream file( path, std::ios::binary );
+		CombinationWriter writer( file, 20, 7, CombinationFormat::Indices );
+		writer.write( combination.begin(), combination.end() );
+		writer.flush();
+	}
+
+	{
+		MappedFile file( path );
+		CombinationReader reader( file );
+
+		EXPECT_EQ( CombinationFileHeader::Size + 7 * combination.size(), file.size() );
+		EXPECT_EQ( combination.size(), reader.size() );
+		EXPECT_EQ( combination.at( 54321 ), reader.at( 54321 ) );
+		EXPECT_EQ( combination.at( combination.size() - 1 ), reader.at( reader.size() - 1 ) );
+	}
+
+	std::remove( path.c_str() );
+	EXPECT_THROW( MappedFile missing( path ), std::system_error );
+}
+#endif
+
+int main( int argc, char** argv )
+{
+	::testing::InitGoogleTest( &argc, argv );
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,209 @@
+/**
+ * Copyright ©2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#include <algorithm>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <map>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "Combination.hpp"
+#include "CombinationSampler.hpp"
+
+/**
+ * Notes:
+ *   - Requires that gtest is installed on the system.
+ *
+ * To compile the test
+ *     $ g++ test_CombinationSampler.cpp -L/usr/lib/ -lgtest -lgtest_main -pthread -o test_all
+ *
+ * Then to run the test
+ *     $ ./test_all
+ */
+
+static bool isSubset(
+	const std::vector< size_t >& subset,
+	size_t numberElements,
+	size_t subsetSize )
+{
+	bool increasing = std::adjacent_find( subset.begin(), subset.end(),
+		[]( size_t left, size_t right ) { return right <= left; } ) == subset.end();
+
+	return increasing and ( subsetSize == subset.size() ) and ( subset.back() < numberElements );
+}
+
+TEST( CombinationSampler, nextShouldDrawEverySubsetUniformly )
+{
+	// Both the direct draw and the complement draw, for K over N / 2.
+	for ( size_t subsetSize : { 3, 5 } )
+	{
+		CombinationSampler sampler( 6, subsetSize, 12345 );
+		Combination combination( 6, subsetSize );
+		std::map< std::vector< size_t >, size_t > counts;
+		const size_t draws = 20000 * combination.size();
+
+		for ( size_t draw = 0; draw < draws; ++draw )
+		{
+			const auto& subset = sampler.next();
+			ASSERT_TRUE( isSubset( subset, 6, subsetSize ) );
+			++counts[ subset ];
+		}
+
+		ASSERT_EQ( combination.size(), counts.size() );
+
+		for ( const auto& count : counts )
+		{
+			EXPECT_NEAR( 20000.0, double( count.second ), 1000.0 );
+		}
+	}
+}
+
+TEST( CombinationSampler, nextShouldSampleSpacesTooLargeToEnumerate )
+{
+	BasicCombinationSampler< uint8_t > sampler( 200, 12, 7 );
+	std::vector< uint8_t > subset( 12 );
+
+	for ( size_t draw = 0; draw < 1000; ++draw )
+	{
+		sampler.next( subset.data() );
+		ASSERT_TRUE( std::is_sorted( subset.begin(), subset.end() ) );
+		ASSERT_EQ( subset.end(), std::adjacent_find( subset.begin(), subset.end() ) );
+		ASSERT_GT( 200, subset.back() );
+	}
+
+	EXPECT_THROW( CombinationSampler( 4, 0 ).next(), std::out_of_range );
+	EXPECT_THROW( CombinationSampler( 4, 5 ).next(), std::out_of_range );
+	EXPECT_THROW( BasicCombinationSampler< uint8_t >( 257, 2 ), std::invalid_argument );
+	EXPECT_EQ( ( std::vector< size_t > { 0, 1, 2, 3 } ), CombinationSampler( 4, 4 ).next() );
+}
+
+TEST( CombinationSampler, samplersShouldBeReproducibleByStream )
+{
+	CombinationSampler sampler( 50, 6, 99 );
+	CombinationSampler same( 50, 6, 99 );
+	CombinationSampler other = sampler.forStream( 1 );
+	size_t differences = 0;
+
+	EXPECT_EQ( 99, other.seed() );
+	EXPECT_EQ( 1, other.stream() );
+
+	for ( size_t draw = 0; draw < 100; ++draw )
+	{
+		std::vector< size_t > subset( sampler.next() );
+		ASSERT_EQ( subset, same.next() );
+		differences += ( subset != other.next() );
+	}
+
+	EXPECT_LT( 90, differences );
+}
+
+TEST( CombinationSampler, forStreamShouldGiveEachThreadItsOwnSampler )
+{
+	CombinationSampler sampler( 30, 4, 2022 );
+	std::vector< std::vector< size_t > > parallel( 4 );
+	std::vector< std::thread > workers;
+
+	for ( size_t thread = 0; thread < 4; ++thread )
+	{
+		workers.emplace_back( [ &parallel, &sampler, thread ]() {
+			auto local = sampler.forStream( thread );
+			for ( size_t draw = 0; draw < 100; ++draw ) {
+				const auto& subset = local.next();
+				parallel[ thread ].insert( parallel[ thread ].end(), subset.begin(), subset.end() ); } } );
+	}
+
+	for ( auto& worker : workers )
+	{
+		worker.join();
+	}
+
+	for ( size_t thread = 0; thread < 4; ++thread )
+	{
+		auto local = sampler.forStream( thread );
+		std::vector< size_t > serial;
+
+		for ( size_t draw = 0; draw < 100; ++draw )
+		{
+			const auto& subset = local.next();
+			serial.insert( serial.end(), subset.begin(), subset.end() );
+		}
+
+		EXPECT_EQ( serial, parallel[ thread ] );
+	}
+}
+
+TEST( CombinationSampler, sampleDistinctShouldDrawDistinctSubsetsInOrder )
+{
+	CombinationSampler sampler( 20, 5, 3 );
+	Combination combination( 20, 5 );
+	std::vector< size_t > batch( 500 * 5 );
+
+	EXPECT_EQ( 500, sampler.sampleDistinct( batch.data(), 500 ) );
+
+	size_t previousRank = 0;
+
+	for ( size_t index = 0; index < 500; ++index )
+	{
+		std::vector< size_t > subset( batch.begin() + index * 5, batch.begin() + ( index + 1 ) * 5 );
+		size_t rank = combination.rank( subset );
+
+		ASSERT_TRUE( ( 0 == index ) or ( previousRank < rank ) );
+		previousRank = rank;
+	}
+
+	EXPECT_THROW( sampler.sampleDistinct( batch.data(), combination.size() + 1 ), std::invalid_argument );
+	EXPECT_EQ( 0, sampler.sampleDistinct( batch.data(), 0 ) );
+}
+
+TEST( CombinationSampler, sampleDistinctOfEverySubsetShouldEnumerate )
+{
+	CombinationSampler sampler( 9, 4, 11 );
+	Combination combination( 9, 4 );
+	std::vector< size_t > batch( combination.size() * 4 );
+	std::vector< size_t > expected;
+
+	for ( const auto& subset : combination )
+	{
+		expected.insert( expected.end(), subset.begin(), subset.end() );
+	}
+
+	sampler.sampleDistinct( batch.data(), combination.size() );
+
+	EXPECT_EQ( expected, batch );
+}
+
+TEST( CombinationSampler, sampleDistinctShouldReachHighRanks )
+{
+	// 67 choose 33 lies between 2^63 and 2^64, so some jumps can't be an iterator offset.
+	CombinationSampler sampler( 67, 33, 5 );
+	Combination combination( 67, 33 );
+	std::vector< size_t > batch( 64 * 33 );
+	size_t highRanks = 0;
+	size_t previousRank = 0;
+
+	sampler.sampleDistinct( batch.data(), 64 );
+
+	for ( size_t index = 0; index < 64; ++index )
+	{
+		std::vector< size_t > subset( batch.begin() + index * 33, batch.begin() + ( index + 1 ) * 33 );
+		ASSERT_TRUE( isSubset( subset, 67, 33 ) );
+
+		size_t rank = combination.rank( subset );
+		ASSERT_TRUE( ( 0 == index ) or ( previousRank < rank ) );
+		highRanks += ( ( size_t( 1 ) << 63 ) < rank );
+		previousRank = rank;
+	}
+
+	EXPECT_LT( 0, highRanks );
+	EXPECT_THROW( CombinationSampler( 200, 100 ).sampleDistinct( batch.data(), 1 ), std::overflow_error );
+}
+
+int main( int argc, char** argv )
+{
+	::testing::InitGoogleTest( &argc, argv );
+	return RUN_ALL_TESTS();
+}
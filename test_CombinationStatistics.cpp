@@ -0,0 +1,111 @@
+/**
+ * Copyright ©2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#if !defined( COMBINATION_ENABLE_STATISTICS )
+#define COMBINATION_ENABLE_STATISTICS
+#endif
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#include "Combination.hpp"
+#include "CombinationStatistics.hpp"
+#include "ParallelForEach.hpp"
+
+/**
+ * Notes:
+ *   - Requires that gtest is installed on the system.
+ *
+ * To compile the test
+ *     $ g++ test_CombinationStatistics.cpp -L/usr/lib/ -lgtest -lgtest_main -pthread -o test_all
+ *
+ * Then to run the test
+ *     $ ./test_all
+ */
+
+TEST( CombinationStatistics, incrementsShouldCountCarries )
+{
+	Combination combination( 9, 4 );
+	uint64_t carries = 0;
+
+	// Each increment walks back past the trailing offsets already at their maximum.
+	for ( const auto& subset : combination )
+	{
+		for ( size_t index = 4; index-- and ( subset[ index ] == 5 + index ); ++carries );
+	}
+
+	threadCombinationStatistics() = CombinationStatistics();
+
+	for ( auto iterator = combination.begin(); iterator != combination.end(); ++iterator );
+
+	const auto& statistics = threadCombinationStatistics();
+
+	EXPECT_EQ( combination.size(), statistics.increments );
+	EXPECT_EQ( carries, statistics.carries );
+	EXPECT_EQ( 1, statistics.allocations );
+	EXPECT_EQ( 0, statistics.copies );
+	EXPECT_EQ( 0, statistics.seeks );
+}
+
+TEST( CombinationStatistics, shouldCountCopiesAllocationsAndSeeks )
+{
+	Combination combination( 10, 3 );
+	threadCombinationStatistics() = CombinationStatistics();
+
+	auto last = combination.end();
+	auto first = combination.begin();
+	auto copy = first;
+	copy = first;
+	auto jumped = first + 40;
+	combination.slice( 10, 20 );
+
+	const auto& statistics = threadCombinationStatistics();
+
+	// begin() and the copy allocate, while reassigning the copy reuses its buffer.
+	EXPECT_EQ( 3, statistics.copies );
+	EXPECT_EQ( 5, statistics.allocations );
+	EXPECT_EQ( 3, statistics.seeks );
+	EXPECT_NE( last, jumped );
+}
+
+TEST( CombinationStatistics, shouldBeKeptPerThread )
+{
+	threadCombinationStatistics() = CombinationStatistics();
+	uint64_t otherIncrements = 0;
+
+	std::thread other( [ & ]() {
+		for ( auto iterator = Combination( 8, 2 ).begin(); iterator != Combination( 8, 2 ).end(); ++iterator );
+		otherIncrements = threadCombinationStatistics().increments; } );
+	other.join();
+
+	EXPECT_EQ( 28, otherIncrements );
+	EXPECT_EQ( 0, threadCombinationStatistics().increments );
+}
+
+TEST( CombinationStatistics, parallelForEachShouldReportCountersOfEachThread )
+{
+	Combination combination( 14, 5 );
+	std::vector< ParallelWorkerStatistics > statistics;
+	CombinationStatistics total;
+
+	parallelForEach( combination, []( const std::vector< size_t >& ) {}, 4, 16, &statistics );
+
+	for ( const auto& work : statistics )
+	{
+		total += work.combination;
+		EXPECT_EQ( work.subsets, work.combination.increments );
+	}
+
+	EXPECT_EQ( combination.size(), total.increments );
+	EXPECT_LE( 1, total.seeks );
+}
+
+int main( int argc, char** argv )
+{
+	::testing::InitGoogleTest( &argc, argv );
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,117 @@
+/**
+ * Copyright ©2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#include <array>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "Combination.hpp"
+#include "CombinationView.hpp"
+
+/**
+ * Notes:
+ *   - Requires that gtest is installed on the system.
+ *
+ * To compile the test
+ *     $ g++ test_CombinationView.cpp -L/usr/lib/ -lgtest -lgtest_main -pthread -o test_all
+ *
+ * Then to run the test
+ *     $ ./test_all
+ */
+
+TEST( CombinationView, subsetsShouldReferenceContainerElements )
+{
+	std::vector< std::string > names { "ann", "bob", "cat", "dan", "eve" };
+	auto view = combinationsOf( names, 3 );
+	Combination combination( names.size(), 3 );
+	auto offsets = combination.begin();
+	size_t count = 0;
+
+	for ( const auto& subset : view )
+	{
+		ASSERT_EQ( 3, subset.size() );
+		ASSERT_EQ( *offsets, subset.offsets() );
+
+		size_t index = 0;
+		for ( const std::string& name : subset )
+		{
+			ASSERT_EQ( &names[ ( *offsets )[ index ] ], &name );
+			ASSERT_EQ( &names[ ( *offsets )[ index ] ], &subset[ index ] );
+			++index;
+		}
+
+		++offsets;
+		++count;
+	}
+
+	EXPECT_EQ( view.size(), count );
+	EXPECT_EQ( combination.end(), offsets );
+}
+
+TEST( CombinationView, subsetsOfMutableContainerShouldBeAssignable )
+{
+	std::array< int, 4 > values {{ 0, 0, 0, 0 }};
+
+	for ( const auto& subset : combinationsOf( values, 2 ) )
+	{
+		for ( int& value : subset )
+		{
+			++value;
+		}
+	}
+
+	// Each element is in 3 of the 6 subsets.
+	EXPECT_EQ( ( std::array< int, 4 > {{ 3, 3, 3, 3 }} ), values );
+}
+
+TEST( CombinationView, emptyEnumerationShouldHaveBeginEqualToEnd )
+{
+	std::vector< int > values { 1, 2 };
+	auto view = combinationsOf( values, 3 );
+
+	EXPECT_EQ( view.begin(), view.end() );
+}
+
+TEST( MaterializedCombinationView, subsetsShouldCopySelectedElements )
+{
+	std::vector< double > weights { 0.5, 1.5, 2.5, 3.5, 4.5, 5.5, 6.5 };
+	auto view = materializedCombinationsOf( weights, 4 );
+	size_t count = 0;
+
+	for ( auto iterator = view.begin(); iterator != view.end(); ++iterator )
+	{
+		std::vector< double > expected;
+
+		for ( size_t offset : *iterator.offsets() )
+		{
+			expected.push_back( weights[ offset ] );
+		}
+
+		ASSERT_EQ( expected, *iterator );
+		++count;
+	}
+
+	EXPECT_EQ( view.size(), count );
+}
+
+TEST( MaterializedCombinationView, scratchBufferShouldBeReused )
+{
+	std::vector< int > values { 1, 2, 3, 4, 5, 6 };
+	auto view = materializedCombinationsOf( values, 3 );
+	auto iterator = view.begin();
+	const int* buffer = iterator->data();
+
+	for ( ; iterator != view.end(); ++iterator )
+	{
+		ASSERT_EQ( buffer, iterator->data() );
+	}
+}
+
+int main( int argc, char** argv )
+{
+	::testing::InitGoogleTest( &argc, argv );
+	return RUN_ALL_TESTS();
+}
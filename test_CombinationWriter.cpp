@@ -0,0 +1,139 @@
+/**
+ * Copyright ©2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Combination.hpp"
+#include "CombinationWriter.hpp"
+
+/**
+ * Notes:
+ *   - Requires that gtest is installed on the system.
+ *
+ * To compile the test
+ *     $ g++ test_CombinationWriter.cpp -L/usr/lib/ -lgtest -lgtest_main -pthread -o test_all
+ *
+ * Then to run the test
+ *     $ ./test_all
+ */
+
+static std::vector< uint8_t > records(
+	const std::string& bytes )
+{
+	return std::vector< uint8_t >( bytes.begin() + CombinationFileHeader::Size, bytes.end() );
+}
+
+TEST( CombinationWriter, constructorShouldWriteHeader )
+{
+	std::ostringstream stream;
+
+	{
+		CombinationWriter writer( stream, 300, 4, CombinationFormat::Delta, 77 );
+	}
+
+	std::string bytes = stream.str();
+	ASSERT_EQ( size_t( CombinationFileHeader::Size ), bytes.size() );
+
+	auto header = CombinationFileHeader::decode( reinterpret_cast< const uint8_t* >( bytes.data() ), bytes.size() );
+
+	EXPECT_EQ( "CMBN", bytes.substr( 0, 4 ) );
+	EXPECT_EQ( 300, header.numberElements() );
+	EXPECT_EQ( 4, header.subsetSize() );
+	EXPECT_EQ( CombinationFormat::Delta, header.format() );
+	EXPECT_EQ( 77, header.firstRank() );
+	EXPECT_EQ( 2, header.indexWidth() );
+}
+
+TEST( CombinationWriter, indicesShouldUseNarrowestWidth )
+{
+	std::ostringstream stream;
+	CombinationWriter writer( stream, 300, 2, CombinationFormat::Indices );
+
+	writer.write( std::vector< size_t > { 1, 258 } );
+	writer.flush();
+
+	EXPECT_EQ( ( std::vector< uint8_t > { 1, 0, 2, 1 } ), records( stream.str() ) );
+	EXPECT_EQ( 1, CombinationFileHeader( 256, 2 ).indexWidth() );
+	EXPECT_EQ( 4, CombinationFileHeader( 65537, 2 ).indexWidth() );
+	EXPECT_EQ( 8, CombinationFileHeader( ( uint64_t( 1 ) << 32 ) + 1, 2 ).indexWidth() );
+}
+
+TEST( CombinationWriter, bitmaskShouldSetOneBitPerOffset )
+{
+	std::ostringstream stream;
+	CombinationWriter writer( stream, 10, 3, CombinationFormat::Bitmask );
+
+	writer.write( std::vector< uint8_t > { 0, 3, 9 } );
+	writer.flush();
+
+	EXPECT_EQ( ( std::vector< uint8_t > { 0x09, 0x02 } ), records( stream.str() ) );
+}
+
+TEST( CombinationWriter, deltaShouldWriteSharedPrefixAndGaps )
+{
+	std::ostringstream stream;
+	CombinationWriter writer( stream, 200, 3, CombinationFormat::Delta );
+
+	writer.write( std::vector< size_t > { 0, 1, 2 } );
+	writer.write( std::vector< size_t > { 0, 1, 3 } );
+	writer.write( std::vector< size_t > { 0, 150, 151 } );
+	writer.flush();
+
+	EXPECT_EQ( ( std::vector< uint8_t > { 0, 0, 0, 0, 2, 1, 1, 0x95, 0x01, 0 } ), records( stream.str() ) );
+}
+
+TEST( CombinationWriter, deltaShouldWriteKeyframes )
+{
+	std::ostringstream stream;
+	Combination combination( 30, 3 );
+	CombinationWriter writer( stream, 30, 3, CombinationFormat::Delta );
+
+	writer.write( combination.begin(), combination.begin() + CombinationFileHeader::DeltaKeyframeInterval + 1 );
+	writer.flush();
+
+	// The subset following the keyframe interval is written out whole, rather than as { 2, 0 }.
+	auto bytes = records( stream.str() );
+	std::vector< size_t > last( combination.at( CombinationFileHeader::DeltaKeyframeInterval ) );
+
+	ASSERT_EQ( ( std::vector< size_t > { 0, 12, 16 } ), last );
+	EXPECT_EQ( ( std::vector< uint8_t > { 0, 0, 11, 3 } ), std::vector< uint8_t >( bytes.end() - 4, bytes.end() ) );
+}
+
+TEST( CombinationWriter, writeShouldCountSubsets )
+{
+	std::ostringstream stream;
+	Combination combination( 12, 4 );
+	CombinationWriter writer( stream, 12, 4, CombinationFormat::Indices );
+
+	EXPECT_EQ( 100, writer.write( combination.begin(), combination.begin() + 100 ) );
+	EXPECT_EQ( 395, writer.write( combination.drop( 100 ).begin(), combination.end() ) );
+	EXPECT_EQ( 495, writer.count() );
+
+	writer.flush();
+
+	EXPECT_EQ( CombinationFileHeader::Size + 495 * 4, stream.str().size() );
+}
+
+TEST( CombinationWriter, writeShouldRejectInvalidSubsets )
+{
+	std::ostringstream stream;
+	CombinationWriter writer( stream, 8, 3, CombinationFormat::Bitmask );
+
+	EXPECT_THROW( writer.write( std::vector< size_t > { 0, 1 } ), std::invalid_argument );
+	EXPECT_THROW( writer.write( std::vector< size_t > { 0, 1, 8 } ), std::invalid_argument );
+	EXPECT_THROW( writer.write( std::vector< size_t > { 0, 2, 2 } ), std::invalid_argument );
+	EXPECT_EQ( 0, writer.count() );
+}
+
+int main( int argc, char** argv )
+{
+	::testing::InitGoogleTest( &argc, argv );
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,92 @@
+/**
+ * Copyright ©2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <limits>
+#include <stdexcept>
+
+#include "BinomialCoefficient.hpp"
+#include "CompletionTable.hpp"
+
+/**
+ * Notes:
+ *   - Requires that gtest is installed on the system.
+ *
+ * To compile the test
+ *     $ g++ test_CompletionTable.cpp -L/usr/lib/ -lgtest -lgtest_main -pthread -o test_all
+ *
+ * Then to run the test
+ *     $ ./test_all
+ */
+
+namespace
+{
+
+CompletionTable binomialTable(
+	size_t n,
+	size_t k )
+{
+	CompletionTable table( n, k );
+	table.build( 0, [ &table ]( size_t element, size_t column ) {
+		return CompletionTable::add( table.count( element + 1, column ),
+			column ? table.count( element + 1, column - 1 ) : 0 ); } );
+
+	return table;
+}
+
+} // namespace
+
+TEST( CompletionTable, addShouldSaturate )
+{
+	size_t maximum = std::numeric_limits< size_t >::max();
+
+	EXPECT_EQ( 5, CompletionTable::add( 2, 3 ) );
+	EXPECT_EQ( maximum, CompletionTable::add( maximum - 1, 1 ) );
+	EXPECT_EQ( maximum, CompletionTable::add( maximum - 1, 2 ) );
+	EXPECT_EQ( maximum, CompletionTable::add( maximum, maximum ) );
+}
+
+TEST( CompletionTable, buildShouldCountBinomialCoefficients )
+{
+	CompletionTable table = binomialTable( 12, 5 );
+
+	for ( size_t element = 0; element <= 12; ++element )
+	{
+		for ( size_t column = 0; column <= 5; ++column )
+		{
+			size_t expected = 0;
+			ASSERT_TRUE( ( 12 - element < column ) or binomialCoefficient( 12 - element, column, expected ) );
+			EXPECT_EQ( expected, table.checkedCount( element, column ) );
+		}
+	}
+}
+
+TEST( CompletionTable, buildShouldResetThePreviousCounts )
+{
+	CompletionTable table = binomialTable( 6, 3 );
+	table.build( 3, [ &table ]( size_t element, size_t column ) {
+		return table.count( element + 1, column ); } );
+
+	EXPECT_EQ( 1, table.checkedCount( 0, 3 ) );
+	EXPECT_EQ( 0, table.checkedCount( 0, 0 ) );
+}
+
+TEST( CompletionTable, checkedCountShouldThrowOnceSaturated )
+{
+	// 100 choose 50 is past a size_t, though 100 choose 2 and 50 choose 50 are not.
+	CompletionTable table = binomialTable( 100, 50 );
+
+	EXPECT_EQ( std::numeric_limits< size_t >::max(), table.count( 0, 50 ) );
+	EXPECT_THROW( table.checkedCount( 0, 50 ), std::overflow_error );
+	EXPECT_EQ( 4950, table.checkedCount( 0, 2 ) );
+	EXPECT_EQ( 1, table.checkedCount( 50, 50 ) );
+}
+
+int main( int argc, char** argv )
+{
+	::testing::InitGoogleTest( &argc, argv );
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,221 @@
+/**
+ * Copyright ©2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "Combination.hpp"
+#include "ConstrainedCombination.hpp"
+#include "ParallelForEach.hpp"
+
+/**
+ * Notes:
+ *   - Requires that gtest is installed on the system.
+ *
+ * To compile the test
+ *     $ g++ test_ConstrainedCombination.cpp -L/usr/lib/ -lgtest -lgtest_main -pthread -o test_all
+ *
+ * Then to run the test
+ *     $ ./test_all
+ */
+
+static bool isSatisfied(
+	const std::vector< size_t >& subset )
+{
+	return ( subset.end() != std::find( subset.begin(), subset.end(), 3 ) )
+		and ( subset.end() != std::find( subset.begin(), subset.end(), 7 ) )
+		and ( subset.end() == std::find( subset.begin(), subset.end(), 12 ) )
+		and ( subset[ 0 ] < 10 );
+}
+
+static ConstrainedCombination<> makeConstrained()
+{
+	ConstrainedCombination<> combination( 16, 5 );
+	combination.require( 3 ).require( 7 ).exclude( 12 ).bound( 0, 0, 9 );
+	return combination;
+}
+
+TEST( ConstrainedCombination, DefaultConstructor )
+{
+	ConstrainedCombination<> combination;
+
+	EXPECT_EQ( 0, combination.numberElements() );
+	EXPECT_EQ( 0, combination.subsetSize() );
+	EXPECT_EQ( 0, combination.size() );
+	EXPECT_EQ( combination.begin(), combination.end() );
+}
+
+TEST( ConstrainedCombination, MoveConstructor )
+{
+	ConstrainedCombination<> moveCombination( 7, 4 );
+	ConstrainedCombination<> defaultCombination( std::move( moveCombination ) );
+
+	EXPECT_EQ( 7, defaultCombination.numberElements() );
+	EXPECT_EQ( 4, defaultCombination.subsetSize() );
+	EXPECT_EQ( 0, moveCombination.numberElements() );
+	EXPECT_EQ( 0, moveCombination.subsetSize() );
+}
+
+TEST( ConstrainedCombination, constructorShouldThrowForNumberElementsBeyondRangeOfSizeType )
+{
+	EXPECT_THROW( ConstrainedCombination< uint8_t >( 257, 2 ), std::invalid_argument );
+}
+
+TEST( ConstrainedCombination, constraintsShouldThrowForOutOfRangeArguments )
+{
+	ConstrainedCombination<> combination( 10, 3 );
+
+	EXPECT_THROW( combination.require( 10 ), std::out_of_range );
+	EXPECT_THROW( combination.exclude( 10 ), std::out_of_range );
+	EXPECT_THROW( combination.bound( 3, 0, 9 ), std::out_of_range );
+}
+
+TEST( ConstrainedCombination, unconstrainedEnumerationShouldMatchCombination )
+{
+	for ( size_t numberElements = 0; numberElements <= 9; ++numberElements )
+	{
+		for ( size_t subsetSize = 0; subsetSize <= numberElements + 1; ++subsetSize )
+		{
+			ConstrainedCombination<> constrained( numberElements, subsetSize );
+			Combination combination( numberElements, subsetSize );
+
+			EXPECT_EQ( combination.size(), constrained.size() );
+			EXPECT_TRUE( std::equal( combination.begin(), combination.end(), constrained.begin(), constrained.end() ) )
+				<< numberElements << " choose " << subsetSize;
+		}
+	}
+}
+
+TEST( ConstrainedCombination, enumerationShouldMatchFilteredCombination )
+{
+	ConstrainedCombination<> constrained = makeConstrained();
+	std::vector< std::vector< size_t > > expected;
+
+	for ( const auto& subset : Combination( 16, 5 ) )
+	{
+		if ( isSatisfied( subset ) )
+		{
+			expected.push_back( subset );
+		}
+	}
+
+	std::vector< std::vector< size_t > > enumerated( constrained.begin(), constrained.end() );
+
+	EXPECT_EQ( expected, enumerated );
+	EXPECT_EQ( expected.size(), constrained.size() );
+}
+
+TEST( ConstrainedCombination, atAndRankShouldBeInverses )
+{
+	ConstrainedCombination<> combination = makeConstrained();
+	size_t rank = 0;
+
+	for ( const auto& subset : combination )
+	{
+		ASSERT_EQ( subset, combination.at( rank ) );
+		ASSERT_EQ( rank, combination.rank( subset ) );
+		++rank;
+	}
+
+	EXPECT_THROW( combination.at( rank ), std::out_of_range );
+	EXPECT_THROW( combination.rank( { 0, 1, 2, 4, 5 } ), std::invalid_argument );
+	EXPECT_THROW( combination.rank( { 3, 7, 8, 9, 12 } ), std::invalid_argument );
+	EXPECT_THROW( combination.rank( { 10, 11, 13, 14, 15 } ), std::invalid_argument );
+}
+
+TEST( ConstrainedCombination, infeasibleConstraintsShouldBeEmpty )
+{
+	ConstrainedCombination<> combination( 10, 2 );
+	combination.require( 1 ).require( 2 ).require( 3 );
+
+	EXPECT_EQ( 0, combination.size() );
+	EXPECT_EQ( combination.begin(), combination.end() );
+
+	combination = ConstrainedCombination<>( 10, 2 );
+	combination.bound( 1, 0, 0 );
+
+	EXPECT_EQ( 0, combination.size() );
+	EXPECT_EQ( combination.begin(), combination.end() );
+}
+
+TEST( ConstrainedCombination, laterConstraintShouldReplaceEarlierForSameElement )
+{
+	ConstrainedCombination<> combination( 6, 2 );
+	combination.exclude( 4 ).require( 4 );
+
+	EXPECT_EQ( 5, combination.size() );
+
+	for ( const auto& subset : combination )
+	{
+		EXPECT_NE( subset.end(), std::find( subset.begin(), subset.end(), 4 ) );
+	}
+}
+
+TEST( ConstrainedCombination, iteratorShouldKeepConstraintsItWasCreatedWith )
+{
+	ConstrainedCombination<> combination( 8, 3 );
+	auto iterator = combination.begin();
+	combination.exclude( 0 );
+
+	EXPECT_EQ( ( std::vector< size_t > { 0, 1, 2 } ), *iterator );
+	EXPECT_EQ( ( std::vector< size_t > { 1, 2, 3 } ), *combination.begin() );
+	EXPECT_EQ( ( std::vector< size_t > { 0, 1, 3 } ), *++iterator );
+	EXPECT_NE( combination.begin(), iterator );
+}
+
+TEST( ConstrainedCombination, slicesShouldCoverEnumeration )
+{
+	ConstrainedCombination<> combination = makeConstrained();
+	size_t total = combination.size();
+	std::vector< std::vector< size_t > > sliced;
+
+	for ( size_t firstRank = 0; firstRank < total; firstRank += 7 )
+	{
+		auto slice = combination.slice( firstRank, std::min< size_t >( 7, total - firstRank ) );
+		sliced.insert( sliced.end(), slice.begin(), slice.end() );
+	}
+
+	std::vector< std::vector< size_t > > enumerated( combination.begin(), combination.end() );
+
+	EXPECT_EQ( enumerated, sliced );
+	EXPECT_THROW( combination.slice( total, 1 ), std::out_of_range );
+}
+
+TEST( ConstrainedCombination, parallelForEachShouldVisitEverySubset )
+{
+	ConstrainedCombination<> combination = makeConstrained();
+	std::atomic< size_t > count( 0 );
+	std::atomic< size_t > invalid( 0 );
+
+	parallelForEach( combination, [ & ]( const std::vector< size_t >& subset ) {
+		++count;
+		invalid += not isSatisfied( subset ); }, 4, 3 );
+
+	EXPECT_EQ( combination.size(), count.load() );
+	EXPECT_EQ( 0, invalid.load() );
+}
+
+TEST( ConstrainedCombination, sizeShouldThrowForOverflow )
+{
+	ConstrainedCombination<> combination( 200, 13 );
+
+	EXPECT_THROW( combination.size(), std::overflow_error );
+	EXPECT_EQ( ( std::vector< size_t > { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 } ), *combination.begin() );
+
+	combination.bound( 0, 190, 199 );
+
+	EXPECT_EQ( 0, combination.size() );
+}
+
+int main( int argc, char** argv )
+{
+	::testing::InitGoogleTest( &argc, argv );
+	return RUN_ALL_TESTS();
+}
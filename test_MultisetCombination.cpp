@@ -0,0 +1,171 @@
+/**
+ * Copyright ©2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#include <algorithm>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <set>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "Combination.hpp"
+#include "MultisetCombination.hpp"
+
+/**
+ * Notes:
+ *   - Requires that gtest is installed on the system.
+ *
+ * To compile the test
+ *     $ g++ test_MultisetCombination.cpp -L/usr/lib/ -lgtest -lgtest_main -pthread -o test_all
+ *
+ * Then to run the test
+ *     $ ./test_all
+ */
+
+// The distinct subsets of the expanded multiset, found by deduplicating a Combination.
+static std::vector< std::vector< size_t > > expandedSubsets(
+	const std::vector< size_t >& multiplicities,
+	size_t subsetSize )
+{
+	std::vector< size_t > expanded;
+
+	for ( size_t element = 0; element < multiplicities.size(); ++element )
+	{
+		expanded.insert( expanded.end(), multiplicities[ element ], element );
+	}
+
+	std::set< std::vector< size_t > > subsets;
+
+	for ( const auto& subset : Combination( expanded.size(), subsetSize ) )
+	{
+		std::vector< size_t > elements;
+
+		for ( size_t offset : subset )
+		{
+			elements.push_back( expanded[ offset ] );
+		}
+
+		subsets.insert( elements );
+	}
+
+	return std::vector< std::vector< size_t > >( subsets.begin(), subsets.end() );
+}
+
+TEST( MultisetCombination, DefaultConstructor )
+{
+	MultisetCombination<> combination;
+
+	EXPECT_EQ( 0, combination.numberElements() );
+	EXPECT_EQ( 0, combination.subsetSize() );
+	EXPECT_EQ( 0, combination.size() );
+	EXPECT_EQ( combination.begin(), combination.end() );
+}
+
+TEST( MultisetCombination, MoveConstructor )
+{
+	MultisetCombination<> moveCombination( std::vector< size_t > { 2, 1, 3 }, 4 );
+	MultisetCombination<> defaultCombination( std::move( moveCombination ) );
+
+	EXPECT_EQ( 3, defaultCombination.numberElements() );
+	EXPECT_EQ( 4, defaultCombination.subsetSize() );
+	EXPECT_EQ( 3, defaultCombination.multiplicity( 2 ) );
+	EXPECT_EQ( 0, moveCombination.numberElements() );
+	EXPECT_EQ( 0, moveCombination.subsetSize() );
+}
+
+TEST( MultisetCombination, constructorShouldThrowForNumberElementsBeyondRangeOfSizeType )
+{
+	EXPECT_THROW( MultisetCombination< uint8_t >( 257, 2 ), std::invalid_argument );
+}
+
+TEST( MultisetCombination, enumerationShouldMatchDeduplicatedCombination )
+{
+	std::vector< std::vector< size_t > > multisets {
+		{ 1 }, { 3 }, { 2, 1, 3 }, { 0, 2, 0, 1 }, { 1, 1, 1, 1, 1 }, { 4, 4, 4 }, { 3, 0, 2, 1, 2 } };
+
+	for ( const auto& multiplicities : multisets )
+	{
+		for ( size_t subsetSize = 0; subsetSize <= 9; ++subsetSize )
+		{
+			MultisetCombination<> combination( multiplicities, subsetSize );
+			std::vector< std::vector< size_t > > enumerated( combination.begin(), combination.end() );
+			std::vector< std::vector< size_t > > expected;
+
+			if ( 0 < subsetSize )
+			{
+				expected = expandedSubsets( multiplicities, subsetSize );
+			}
+
+			ASSERT_EQ( expected, enumerated ) << "subset size " << subsetSize;
+			EXPECT_EQ( expected.size(), combination.size() );
+		}
+	}
+}
+
+TEST( MultisetCombination, repetitionShouldEnumerateAllNonDecreasingSequences )
+{
+	MultisetCombination<> combination( 3, 2 );
+	std::vector< std::vector< size_t > > expected {
+		{ 0, 0 }, { 0, 1 }, { 0, 2 }, { 1, 1 }, { 1, 2 }, { 2, 2 } };
+	std::vector< std::vector< size_t > > enumerated( combination.begin(), combination.end() );
+
+	EXPECT_EQ( expected, enumerated );
+
+	// C(N + K - 1, K) for combinations with repetition.
+	EXPECT_EQ( 3876, MultisetCombination<>( 5, 15 ).size() );
+	EXPECT_EQ( 15, MultisetCombination<>( 1, 15 ).begin()->size() );
+}
+
+TEST( MultisetCombination, atAndRankShouldBeInverses )
+{
+	MultisetCombination<> combination( std::vector< size_t > { 3, 0, 2, 1, 2 }, 5 );
+	size_t rank = 0;
+
+	for ( const auto& subset : combination )
+	{
+		ASSERT_EQ( subset, combination.at( rank ) );
+		ASSERT_EQ( rank, combination.rank( subset ) );
+		++rank;
+	}
+
+	EXPECT_THROW( combination.at( rank ), std::out_of_range );
+	EXPECT_THROW( combination.rank( { 0, 0, 0, 0, 2 } ), std::invalid_argument );
+	EXPECT_THROW( combination.rank( { 0, 1, 2, 3, 4 } ), std::invalid_argument );
+	EXPECT_THROW( combination.rank( { 2, 0, 0, 3, 4 } ), std::invalid_argument );
+	EXPECT_THROW( combination.rank( { 0, 2, 3 } ), std::invalid_argument );
+}
+
+TEST( MultisetCombination, slicesShouldCoverEnumeration )
+{
+	MultisetCombination<> combination( 6, 4 );
+	size_t total = combination.size();
+	std::vector< std::vector< size_t > > sliced;
+
+	for ( size_t firstRank = 0; firstRank < total; firstRank += 11 )
+	{
+		auto slice = combination.slice( firstRank, std::min< size_t >( 11, total - firstRank ) );
+		sliced.insert( sliced.end(), slice.begin(), slice.end() );
+	}
+
+	std::vector< std::vector< size_t > > enumerated( combination.begin(), combination.end() );
+
+	EXPECT_EQ( enumerated, sliced );
+	EXPECT_THROW( combination.slice( total, 1 ), std::out_of_range );
+}
+
+TEST( MultisetCombination, sizeShouldThrowForOverflow )
+{
+	MultisetCombination<> combination( 100, 40 );
+
+	EXPECT_THROW( combination.size(), std::overflow_error );
+	EXPECT_EQ( std::vector< size_t >( 40, 0 ), *combination.begin() );
+}
+
+int main( int argc, char** argv )
+{
+	::testing::InitGoogleTest( &argc, argv );
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,220 @@
+/**
+ * Copyright ©2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "Combination.hpp"
+#include "NestedCombination.hpp"
+#include "ParallelForEach.hpp"
+
+/**
+ * Notes:
+ *   - Requires that gtest is installed on the system.
+ *
+ * To compile the test
+ *     $ g++ test_NestedCombination.cpp -L/usr/lib/ -lgtest -lgtest_main -pthread -o test_all
+ *
+ * Then to run the test
+ *     $ ./test_all
+ */
+
+using Pair = std::pair< std::vector< size_t >, std::vector< size_t > >;
+
+// The pairs of the nested loop the enumerator replaces.
+static std::vector< Pair > nestedLoop(
+	size_t numberElements,
+	size_t outerSize,
+	size_t innerSize,
+	NestedCombinationSource source )
+{
+	std::vector< Pair > pairs;
+
+	for ( const auto& outer : Combination( numberElements, outerSize ) )
+	{
+		std::vector< size_t > elements;
+
+		for ( size_t element = 0; element < numberElements; ++element )
+		{
+			bool chosen = std::binary_search( outer.begin(), outer.end(), element );
+
+			if ( chosen == ( NestedCombinationSource::Chosen == source ) )
+			{
+				elements.push_back( element );
+			}
+		}
+
+		for ( const auto& indices : Combination( elements.size(), innerSize ) )
+		{
+			std::vector< size_t > inner;
+
+			for ( size_t index : indices )
+			{
+				inner.push_back( elements[ index ] );
+			}
+
+			pairs.emplace_back( outer, inner );
+		}
+	}
+
+	return pairs;
+}
+
+TEST( NestedCombination, DefaultConstructor )
+{
+	NestedCombination<> combination;
+
+	EXPECT_EQ( 0, combination.numberElements() );
+	EXPECT_EQ( 0, combination.outerSize() );
+	EXPECT_EQ( 0, combination.innerSize() );
+	EXPECT_EQ( NestedCombinationSource::Complement, combination.source() );
+	EXPECT_EQ( 0, combination.size() );
+	EXPECT_EQ( combination.begin(), combination.end() );
+}
+
+TEST( NestedCombination, MoveConstructor )
+{
+	NestedCombination<> moveCombination( 9, 4, 2, NestedCombinationSource::Chosen );
+	NestedCombination<> defaultCombination( std::move( moveCombination ) );
+
+	EXPECT_EQ( 9, defaultCombination.numberElements() );
+	EXPECT_EQ( 4, defaultCombination.outerSize() );
+	EXPECT_EQ( 2, defaultCombination.innerSize() );
+	EXPECT_EQ( NestedCombinationSource::Chosen, defaultCombination.source() );
+	EXPECT_EQ( 0, moveCombination.numberElements() );
+	EXPECT_EQ( 0, moveCombination.outerSize() );
+}
+
+TEST( NestedCombination, constructorShouldThrowForNumberElementsBeyondRangeOfSizeType )
+{
+	EXPECT_THROW( NestedCombination< uint8_t >( 257, 2, 2 ), std::invalid_argument );
+}
+
+TEST( NestedCombination, sizeShouldThrowOnOverflow )
+{
+	EXPECT_THROW( NestedCombination<>( 70, 30, 20 ).size(), std::overflow_error );
+	EXPECT_THROW( NestedCombination<>( 100, 50, 1 ).size(), std::overflow_error );
+}
+
+TEST( NestedCombination, enumerationShouldMatchNestedLoop )
+{
+	for ( NestedCombinationSource source : { NestedCombinationSource::Complement, NestedCombinationSource::Chosen } )
+	{
+		for ( size_t numberElements = 0; numberElements <= 8; ++numberElements )
+		{
+			for ( size_t outerSize = 0; outerSize <= numberElements + 1; ++outerSize )
+			{
+				for ( size_t innerSize = 0; innerSize <= numberElements + 1; ++innerSize )
+				{
+					std::vector< Pair > expected = nestedLoop( numberElements, outerSize, innerSize, source );
+					NestedCombination<> combination( numberElements, outerSize, innerSize, source );
+					std::vector< Pair > enumerated;
+
+					for ( auto iterator = combination.begin(); iterator != combination.end(); ++iterator )
+					{
+						enumerated.emplace_back( std::vector< size_t >( iterator.outer() ), *iterator );
+					}
+
+					ASSERT_EQ( expected, enumerated ) << numberElements << ", " << outerSize << ", " << innerSize;
+					EXPECT_EQ( expected.size(), combination.size() );
+				}
+			}
+		}
+	}
+}
+
+TEST( NestedCombination, complementShouldStayInStepWithOuter )
+{
+	NestedCombination< uint16_t > combination( 13, 6, 1 );
+	std::vector< uint16_t > elements( 13 );
+	std::iota( elements.begin(), elements.end(), uint16_t( 0 ) );
+
+	for ( auto iterator = combination.begin(); iterator != combination.end(); ++iterator )
+	{
+		std::vector< uint16_t > expected;
+		std::set_difference( elements.begin(), elements.end(), iterator.outer().begin(), iterator.outer().end(),
+			std::back_inserter( expected ) );
+
+		ASSERT_EQ( expected, iterator.complement() );
+		ASSERT_EQ( iterator.complement()[ iterator.innerIndices()[ 0 ] ], ( *iterator )[ 0 ] );
+	}
+}
+
+TEST( NestedCombination, outerChangedShouldMarkEachOuterStep )
+{
+	NestedCombination<> combination( 7, 3, 2 );
+	size_t outerSteps = 0;
+	size_t steps = 0;
+
+	for ( auto iterator = combination.begin(); iterator != combination.end(); ++iterator, ++steps )
+	{
+		ASSERT_EQ( 0 == steps % 6, iterator.outerChanged() );
+		outerSteps += iterator.outerChanged();
+	}
+
+	EXPECT_EQ( Combination( 7, 3 ).size(), outerSteps );
+}
+
+TEST( NestedCombination, incrementShouldReuseBuffers )
+{
+	NestedCombination<> combination( 16, 8, 4 );
+	auto iterator = combination.begin();
+	const size_t* complement = iterator.complement().data();
+	const size_t* inner = iterator->data();
+	const size_t* outer = iterator.outer().data();
+
+	for ( size_t step = 0; step < 10000; ++step, ++iterator )
+	{
+		ASSERT_EQ( complement, iterator.complement().data() );
+		ASSERT_EQ( inner, iterator->data() );
+		ASSERT_EQ( outer, iterator.outer().data() );
+	}
+}
+
+TEST( NestedCombination, sliceShouldMatchEnumeration )
+{
+	NestedCombination<> combination( 9, 4, 3 );
+	std::vector< Pair > expected = nestedLoop( 9, 4, 3, NestedCombinationSource::Complement );
+
+	for ( size_t firstRank : { size_t( 0 ), size_t( 9 ), size_t( 10 ), size_t( 1000 ), combination.size() } )
+	{
+		auto slice = combination.slice( firstRank, std::min( size_t( 37 ), combination.size() - firstRank ) );
+		size_t rank = firstRank;
+
+		for ( auto iterator = slice.begin(); iterator != slice.end(); ++iterator, ++rank )
+		{
+			ASSERT_EQ( expected[ rank ].first, iterator.outer() );
+			ASSERT_EQ( expected[ rank ].second, *iterator );
+		}
+
+		EXPECT_EQ( firstRank + slice.size(), rank );
+	}
+
+	EXPECT_THROW( combination.slice( combination.size(), 1 ), std::out_of_range );
+}
+
+TEST( NestedCombination, parallelForEachShouldVisitEveryPair )
+{
+	NestedCombination<> combination( 12, 4, 4 );
+	std::atomic< size_t > count( 0 );
+
+	parallelForEach( combination, [ & ]( const std::vector< size_t >& inner ) {
+		count += ( 4 == inner.size() ); }, 4, 100 );
+
+	EXPECT_EQ( combination.size(), count.load() );
+}
+
+int main( int argc, char** argv )
+{
+	::testing::InitGoogleTest( &argc, argv );
+	return RUN_ALL_TESTS();
+}
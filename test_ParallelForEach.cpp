@@ -0,0 +1,147 @@
+/**
+ * Copyright ©2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "Combination.hpp"
+#include "ParallelForEach.hpp"
+
+/**
+ * Notes:
+ *   - Requires that gtest is installed on the system.
+ *
+ * To compile the test
+ *     $ g++ test_ParallelForEach.cpp -L/usr/lib/ -lgtest -lgtest_main -pthread -o test_all
+ *
+ * Then to run the test
+ *     $ ./test_all
+ */
+
+static void expectEachSubsetVisitedOnce(
+	const Combination& combination,
+	size_t threads,
+	size_t grainSize )
+{
+	size_t total = combination.size();
+	std::unique_ptr< std::atomic< size_t >[] > visits( new std::atomic< size_t >[ total ] );
+
+	for ( size_t rank = 0; rank < total; ++rank )
+	{
+		visits[ rank ] = 0;
+	}
+
+	parallelForEach( combination, [ & ]( const std::vector< size_t >& subset )
+		{
+			visits[ combination.rank( subset ) ]++;
+		}, threads, grainSize );
+
+	for ( size_t rank = 0; rank < total; ++rank )
+	{
+		ASSERT_EQ( 1, visits[ rank ] ) << "rank " << rank;
+	}
+}
+
+TEST( ParallelForEach, shouldVisitEachSubsetOnce )
+{
+	expectEachSubsetVisitedOnce( Combination( 16, 5 ), 4, 0 );
+	expectEachSubsetVisitedOnce( Combination( 16, 5 ), 4, 1 );
+	expectEachSubsetVisitedOnce( Combination( 16, 5 ), 3, 7 );
+}
+
+TEST( ParallelForEach, shouldVisitEachSubsetOnceWithSingleThread )
+{
+	expectEachSubsetVisitedOnce( Combination( 12, 4 ), 1, 0 );
+}
+
+TEST( ParallelForEach, shouldVisitEachSubsetOnceWithMoreThreadsThanSubsets )
+{
+	expectEachSubsetVisitedOnce( Combination( 5, 4 ), 16, 0 );
+}
+
+TEST( ParallelForEach, shouldVisitEachSubsetOnceWithUnevenWork )
+{
+	Combination combination( 10, 3 );
+	std::atomic< size_t > count( 0 );
+
+	// Only the first slice is slow, so the other threads have to steal from it.
+	parallelForEach( combination, [ & ]( const std::vector< size_t >& subset )
+		{
+			if ( 0 == subset[ 0 ] )
+			{
+				std::this_thread::sleep_for( std::chrono::microseconds( 200 ) );
+			}
+
+			count++;
+		}, 4, 1 );
+
+	EXPECT_EQ( combination.size(), count );
+}
+
+TEST( ParallelForEach, shouldNotCallFunctionForEmptyEnumeration )
+{
+	std::atomic< size_t > count( 0 );
+
+	parallelForEach( Combination( 3, 7 ), [ & ]( const std::vector< size_t >& )
+		{
+			count++;
+		}, 4 );
+
+	EXPECT_EQ( 0, count );
+}
+
+TEST( ParallelForEach, shouldRethrowExceptionFromFunction )
+{
+	EXPECT_THROW( parallelForEach( Combination( 12, 4 ), []( const std::vector< size_t >& subset )
+		{
+			if ( 3 == subset[ 0 ] )
+			{
+				throw std::runtime_error( "failed" );
+			}
+		}, 4 ), std::runtime_error );
+}
+
+TEST( ParallelForEach, shouldReportWorkOfEachThread )
+{
+	Combination combination( 12, 4 );
+	std::vector< ParallelWorkerStatistics > statistics;
+	uint64_t subsets = 0;
+	uint64_t blocks = 0;
+
+	parallelForEach( combination, [ & ]( const std::vector< size_t >& subset )
+		{
+			if ( 0 == subset[ 0 ] )
+			{
+				std::this_thread::sleep_for( std::chrono::microseconds( 20 ) );
+			}
+		}, 3, 8, &statistics );
+
+	ASSERT_EQ( 3, statistics.size() );
+
+	for ( const auto& work : statistics )
+	{
+		subsets += work.subsets;
+		blocks += work.blocks;
+		EXPECT_LT( 0, work.seconds );
+		EXPECT_LE( 0, work.subsetsPerSecond() );
+#if !defined( COMBINATION_ENABLE_STATISTICS )
+		EXPECT_EQ( 0, work.combination.increments );
+#endif
+	}
+
+	EXPECT_EQ( combination.size(), subsets );
+	EXPECT_LE( combination.size() / 8, blocks );
+}
+
+int main( int argc, char** argv )
+{
+	::testing::InitGoogleTest( &argc, argv );
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,141 @@
+/**
+ * Copyright ©2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#include <algorithm>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "Permutation.hpp"
+
+/**
+ * Notes:
+ *   - Requires that gtest is installed on the system.
+ *
+ * To compile the test
+ *     $ g++ test_Permutation.cpp -L/usr/lib/ -lgtest -lgtest_main -pthread -o test_all
+ *
+ * Then to run the test
+ *     $ ./test_all
+ */
+
+TEST( Permutation, DefaultConstructor )
+{
+	Permutation<> permutation;
+
+	EXPECT_EQ( 0, permutation.numberElements() );
+	EXPECT_EQ( 0, permutation.subsetSize() );
+	EXPECT_EQ( 0, permutation.size() );
+	EXPECT_EQ( permutation.begin(), permutation.end() );
+}
+
+TEST( Permutation, MoveConstructor )
+{
+	Permutation<> movePermutation( 7, 4 );
+	Permutation<> defaultPermutation( std::move( movePermutation ) );
+
+	EXPECT_EQ( 7, defaultPermutation.numberElements() );
+	EXPECT_EQ( 4, defaultPermutation.subsetSize() );
+	EXPECT_EQ( 0, movePermutation.numberElements() );
+	EXPECT_EQ( 0, movePermutation.subsetSize() );
+}
+
+TEST( Permutation, constructorShouldThrowForNumberElementsBeyondRangeOfSizeType )
+{
+	EXPECT_THROW( Permutation< uint8_t >( 257, 2 ), std::invalid_argument );
+}
+
+TEST( Permutation, enumerationShouldMatchLexicographicOrderedSelections )
+{
+	Permutation<> permutation( 4, 2 );
+	std::vector< std::vector< size_t > > expected {
+		{ 0, 1 }, { 0, 2 }, { 0, 3 }, { 1, 0 }, { 1, 2 }, { 1, 3 },
+		{ 2, 0 }, { 2, 1 }, { 2, 3 }, { 3, 0 }, { 3, 1 }, { 3, 2 } };
+	std::vector< std::vector< size_t > > enumerated( permutation.begin(), permutation.end() );
+
+	EXPECT_EQ( expected, enumerated );
+}
+
+TEST( Permutation, fullPermutationShouldMatchNextPermutation )
+{
+	for ( size_t numberElements = 1; numberElements <= 6; ++numberElements )
+	{
+		std::vector< size_t > expected( numberElements );
+		std::iota( expected.begin(), expected.end(), 0 );
+		Permutation<> permutation( numberElements, numberElements );
+		size_t count = 0;
+
+		for ( const auto& selection : permutation )
+		{
+			ASSERT_EQ( expected, selection );
+			std::next_permutation( expected.begin(), expected.end() );
+			++count;
+		}
+
+		EXPECT_EQ( permutation.size(), count );
+	}
+}
+
+TEST( Permutation, sizeShouldBeFallingFactorial )
+{
+	for ( size_t numberElements = 0; numberElements <= 7; ++numberElements )
+	{
+		for ( size_t subsetSize = 0; subsetSize <= numberElements + 1; ++subsetSize )
+		{
+			Permutation<> permutation( numberElements, subsetSize );
+			size_t count = std::distance( permutation.begin(), permutation.end() );
+
+			EXPECT_EQ( count, permutation.size() ) << numberElements << " permute " << subsetSize;
+		}
+	}
+
+	EXPECT_EQ( 870, Permutation<>( 30, 2 ).size() );
+	EXPECT_THROW( Permutation<>( 1000, 7 ).size(), std::overflow_error );
+}
+
+TEST( Permutation, atAndRankShouldBeInverses )
+{
+	Permutation<> permutation( 6, 3 );
+	size_t rank = 0;
+
+	for ( const auto& selection : permutation )
+	{
+		ASSERT_EQ( selection, permutation.at( rank ) );
+		ASSERT_EQ( rank, permutation.rank( selection ) );
+		++rank;
+	}
+
+	EXPECT_THROW( permutation.at( rank ), std::out_of_range );
+	EXPECT_THROW( permutation.rank( { 1, 1, 2 } ), std::invalid_argument );
+	EXPECT_THROW( permutation.rank( { 0, 1, 6 } ), std::invalid_argument );
+	EXPECT_THROW( permutation.rank( { 0, 1 } ), std::invalid_argument );
+}
+
+TEST( Permutation, slicesShouldCoverEnumeration )
+{
+	Permutation<> permutation( 6, 3 );
+	size_t total = permutation.size();
+	std::vector< std::vector< size_t > > sliced;
+
+	for ( size_t firstRank = 0; firstRank < total; firstRank += 17 )
+	{
+		auto slice = permutation.slice( firstRank, std::min< size_t >( 17, total - firstRank ) );
+		sliced.insert( sliced.end(), slice.begin(), slice.end() );
+	}
+
+	std::vector< std::vector< size_t > > enumerated( permutation.begin(), permutation.end() );
+
+	EXPECT_EQ( enumerated, sliced );
+	EXPECT_THROW( permutation.slice( total, 1 ), std::out_of_range );
+}
+
+int main( int argc, char** argv )
+{
+	::testing::InitGoogleTest( &argc, argv );
+	return RUN_ALL_TESTS();
+}
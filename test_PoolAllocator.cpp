@@ -0,0 +1,139 @@
+/**
+ * Copyright ©2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#include <atomic>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#include "Combination.hpp"
+#include "ParallelForEach.hpp"
+#include "PoolAllocator.hpp"
+
+/**
+ * Notes:
+ *   - Requires that gtest is installed on the system.
+ *
+ * To compile the test
+ *     $ g++ test_PoolAllocator.cpp -L/usr/lib/ -lgtest -lgtest_main -pthread -o test_all
+ *
+ * Then to run the test
+ *     $ ./test_all
+ */
+
+using PooledCombination = BasicCombination< uint16_t, PoolAllocator< uint16_t > >;
+
+TEST( PoolAllocator, allocateShouldReuseReleasedBlocksOfSameClass )
+{
+	PoolAllocator< uint32_t > allocator;
+	uint32_t* storage = allocator.allocate( 25 );
+	allocator.deallocate( storage, 25 );
+
+	// 100 and 120 bytes both fall in the 128 byte class.
+	EXPECT_EQ( storage, allocator.allocate( 30 ) );
+	allocator.deallocate( storage, 30 );
+}
+
+TEST( PoolAllocator, freeListsShouldBeBounded )
+{
+	PoolAllocator< uint64_t > allocator;
+	std::vector< uint64_t* > blocks;
+	size_t before = ThreadBlockPool::cachedBlocks();
+
+	for ( size_t block = 0; block < 100; ++block )
+	{
+		blocks.push_back( allocator.allocate( 300 ) );
+	}
+
+	for ( uint64_t* block : blocks )
+	{
+		allocator.deallocate( block, 300 );
+	}
+
+	EXPECT_GE( before + size_t( ThreadBlockPool::MaximumCachedBlocks ), ThreadBlockPool::cachedBlocks() );
+
+	uint64_t* large = allocator.allocate( size_t( 1 ) << 18 );
+	size_t cached = ThreadBlockPool::cachedBlocks();
+	allocator.deallocate( large, size_t( 1 ) << 18 );
+
+	EXPECT_EQ( cached, ThreadBlockPool::cachedBlocks() );
+}
+
+TEST( PoolAllocator, blocksShouldMoveToReleasingThread )
+{
+	PoolAllocator< uint8_t > allocator;
+	uint8_t* storage = nullptr;
+
+	// Both sizes fall in the 64 KiB class, which the other tests leave empty.
+	std::thread other( [ & ]() { storage = allocator.allocate( 40000 ); } );
+	other.join();
+
+	allocator.deallocate( storage, 40000 );
+
+	EXPECT_EQ( storage, allocator.allocate( 60000 ) );
+	allocator.deallocate( storage, 60000 );
+}
+
+TEST( PoolAllocator, allocatorsShouldCompareEqual )
+{
+	PoolAllocator< uint32_t > allocator;
+	PoolAllocator< uint8_t > otherAllocator( allocator );
+
+	EXPECT_TRUE( allocator == otherAllocator );
+	EXPECT_FALSE( allocator != otherAllocator );
+}
+
+TEST( PoolAllocator, combinationShouldEnumerateWithPooledBuffers )
+{
+	PooledCombination pooled( 11, 5 );
+	BasicCombination< uint16_t > plain( 11, 5 );
+	auto expected = plain.begin();
+
+	for ( auto iterator = pooled.begin(); iterator != pooled.end(); ++expected )
+	{
+		// The post-increment copy takes its buffer from the pool and returns it.
+		auto previous = iterator++;
+		ASSERT_TRUE( std::equal( previous->begin(), previous->end(), expected->begin(), expected->end() ) );
+		ASSERT_EQ( plain.rank( *expected ), pooled.rank( *previous ) );
+	}
+
+	EXPECT_EQ( plain.end(), expected );
+	EXPECT_EQ( 3, pooled.rank( { 0, 1, 2, 3, 7 } ) );
+	EXPECT_EQ( pooled.at( 100 ), plain.at( 100 ) );
+}
+
+TEST( PoolAllocator, postIncrementShouldRecycleLargeBuffers )
+{
+	PooledCombination combination( 600, 300 );
+	auto iterator = combination.begin();
+	auto previousIterator = iterator++;
+	const uint16_t* buffer = previousIterator->data();
+
+	previousIterator = PooledCombination::const_iterator();
+
+	for ( size_t step = 0; step < 100; ++step )
+	{
+		auto previous = iterator++;
+		ASSERT_EQ( buffer, previous->data() );
+	}
+}
+
+TEST( PoolAllocator, parallelForEachShouldVisitEverySubset )
+{
+	PooledCombination combination( 16, 6 );
+	std::atomic< size_t > count( 0 );
+
+	parallelForEach( combination, [ & ]( const std::vector< uint16_t, PoolAllocator< uint16_t > >& subset ) {
+		count += ( 6 == subset.size() ); }, 4, 64 );
+
+	EXPECT_EQ( combination.size(), count.load() );
+}
+
+int main( int argc, char** argv )
+{
+	::testing::InitGoogleTest( &argc, argv );
+	return RUN_ALL_TESTS();
+}
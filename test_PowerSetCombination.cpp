@@ -0,0 +1,208 @@
+/**
+ * Copyright ©2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "Combination.hpp"
+#include "ParallelForEach.hpp"
+#include "PowerSetCombination.hpp"
+
+/**
+ * Notes:
+ *   - Requires that gtest is installed on the system.
+ *
+ * To compile the test
+ *     $ g++ test_PowerSetCombination.cpp -L/usr/lib/ -lgtest -lgtest_main -pthread -o test_all
+ *
+ * Then to run the test
+ *     $ ./test_all
+ */
+
+TEST( PowerSetCombination, DefaultConstructor )
+{
+	PowerSetCombination<> combination;
+
+	EXPECT_EQ( 0, combination.numberElements() );
+	EXPECT_EQ( 0, combination.size() );
+	EXPECT_EQ( combination.begin(), combination.end() );
+}
+
+TEST( PowerSetCombination, MoveConstructor )
+{
+	PowerSetCombination<> moveCombination( 7, 2, 4 );
+	PowerSetCombination<> defaultCombination( std::move( moveCombination ) );
+
+	EXPECT_EQ( 7, defaultCombination.numberElements() );
+	EXPECT_EQ( 2, defaultCombination.minimumSubsetSize() );
+	EXPECT_EQ( 4, defaultCombination.maximumSubsetSize() );
+	EXPECT_EQ( 0, moveCombination.numberElements() );
+	EXPECT_EQ( 0, moveCombination.size() );
+}
+
+TEST( PowerSetCombination, constructorShouldClampSubsetSizes )
+{
+	PowerSetCombination<> combination( 5, 0, 9 );
+
+	EXPECT_EQ( 1, combination.minimumSubsetSize() );
+	EXPECT_EQ( 5, combination.maximumSubsetSize() );
+	EXPECT_EQ( 31, combination.size() );
+	EXPECT_EQ( 0, PowerSetCombination<>( 5, 4, 3 ).size() );
+	EXPECT_EQ( PowerSetCombination<>( 5, 4, 3 ).begin(), PowerSetCombination<>( 5, 4, 3 ).end() );
+	EXPECT_THROW( PowerSetCombination< uint8_t >( 257 ), std::invalid_argument );
+}
+
+TEST( PowerSetCombination, enumerationShouldMatchCombinationForEachSize )
+{
+	for ( size_t numberElements = 0; numberElements <= 8; ++numberElements )
+	{
+		for ( size_t minimumSubsetSize = 1; minimumSubsetSize <= numberElements; ++minimumSubsetSize )
+		{
+			for ( size_t maximumSubsetSize = minimumSubsetSize; maximumSubsetSize <= numberElements; ++maximumSubsetSize )
+			{
+				PowerSetCombination<> combination( numberElements, minimumSubsetSize, maximumSubsetSize );
+				std::vector< std::vector< size_t > > expected;
+
+				for ( size_t subsetSize = minimumSubsetSize; subsetSize <= maximumSubsetSize; ++subsetSize )
+				{
+					Combination fixed( numberElements, subsetSize );
+					expected.insert( expected.end(), fixed.begin(), fixed.end() );
+				}
+
+				std::vector< std::vector< size_t > > enumerated( combination.begin(), combination.end() );
+
+				ASSERT_EQ( expected, enumerated );
+				EXPECT_EQ( expected.size(), combination.size() );
+			}
+		}
+	}
+}
+
+TEST( PowerSetCombination, iteratorShouldReuseBufferWithinSize )
+{
+	PowerSetCombination<> combination( 6 );
+	auto iterator = combination.begin();
+	const size_t* buffer = iterator->data();
+	size_t subsetSize = iterator->size();
+
+	for ( ; iterator != combination.end(); ++iterator )
+	{
+		if ( subsetSize != iterator->size() )
+		{
+			buffer = iterator->data();
+			subsetSize = iterator->size();
+		}
+
+		ASSERT_EQ( buffer, iterator->data() );
+	}
+}
+
+TEST( PowerSetCombination, iteratorShouldOnlyHoldCurrentSize )
+{
+	// Every size of 2^31 elements, of which only the smallest is visited.
+	PowerSetCombination< uint32_t > combination( size_t( 1 ) << 31 );
+	auto iterator = combination.begin();
+	auto copy = iterator;
+
+	EXPECT_EQ( 1, iterator->capacity() );
+	EXPECT_EQ( 1, copy->capacity() );
+
+	std::advance( iterator, 1000 );
+	EXPECT_EQ( std::vector< uint32_t > { 1000 }, *iterator );
+	EXPECT_EQ( 1, iterator->capacity() );
+}
+
+TEST( PowerSetCombination, atAndRankShouldBeInverses )
+{
+	PowerSetCombination<> combination( 7, 2, 5 );
+	size_t rank = 0;
+
+	for ( const auto& subset : combination )
+	{
+		ASSERT_EQ( subset, combination.at( rank ) );
+		ASSERT_EQ( rank, combination.rank( subset ) );
+		++rank;
+	}
+
+	EXPECT_THROW( combination.at( rank ), std::out_of_range );
+	EXPECT_THROW( combination.rank( { 3 } ), std::invalid_argument );
+	EXPECT_THROW( combination.rank( { 0, 1, 2, 3, 4, 5 } ), std::invalid_argument );
+	EXPECT_THROW( combination.rank( { 3, 1 } ), std::invalid_argument );
+}
+
+TEST( PowerSetCombination, slicesShouldCoverEnumerationAcrossSizes )
+{
+	PowerSetCombination<> combination( 7 );
+	size_t total = combination.size();
+	std::vector< std::vector< size_t > > sliced;
+
+	for ( size_t firstRank = 0; firstRank < total; firstRank += 13 )
+	{
+		auto slice = combination.slice( firstRank, std::min< size_t >( 13, total - firstRank ) );
+		sliced.insert( sliced.end(), slice.begin(), slice.end() );
+	}
+
+	std::vector< std::vector< size_t > > enumerated( combination.begin(), combination.end() );
+
+	EXPECT_EQ( enumerated, sliced );
+	EXPECT_THROW( combination.slice( total, 1 ), std::out_of_range );
+}
+
+TEST( PowerSetCombination, nextBatchShouldStopAtEachSize )
+{
+	PowerSetCombination<> combination( 6, 2, 4 );
+	auto iterator = combination.begin();
+	std::vector< size_t > batch( 4 * 8 );
+	std::vector< std::vector< size_t > > batched;
+
+	while ( iterator != combination.end() )
+	{
+		size_t subsetSize = iterator->size();
+		size_t count = iterator.nextBatch( batch.data(), 8 );
+
+		ASSERT_LT( 0, count );
+
+		for ( size_t subset = 0; subset < count; ++subset )
+		{
+			batched.emplace_back( batch.begin() + subset * subsetSize, batch.begin() + ( subset + 1 ) * subsetSize );
+		}
+
+		if ( iterator != combination.end() )
+		{
+			ASSERT_TRUE( ( 8 == count ) or ( subsetSize + 1 == iterator->size() ) );
+		}
+	}
+
+	std::vector< std::vector< size_t > > enumerated( combination.begin(), combination.end() );
+
+	EXPECT_EQ( enumerated, batched );
+	EXPECT_EQ( 0, iterator.nextBatch( batch.data(), 8 ) );
+}
+
+TEST( PowerSetCombination, parallelForEachShouldVisitEverySubset )
+{
+	PowerSetCombination<> combination( 12 );
+	std::atomic< size_t > count( 0 );
+	std::atomic< size_t > elements( 0 );
+
+	parallelForEach( combination, [ & ]( const std::vector< size_t >& subset ) {
+		++count;
+		elements += subset.size(); }, 4, 16 );
+
+	EXPECT_EQ( 4095, count.load() );
+	EXPECT_EQ( 12 * 2048, elements.load() );
+}
+
+int main( int argc, char** argv )
+{
+	::testing::InitGoogleTest( &argc, argv );
+	return RUN_ALL_TESTS();
+}
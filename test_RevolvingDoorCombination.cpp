@@ -0,0 +1,119 @@
+/**
+ * Copyright ©2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#include <algorithm>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <set>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "Combination.hpp"
+#include "RevolvingDoorCombination.hpp"
+
+/**
+ * Notes:
+ *   - Requires that gtest is installed on the system.
+ *
+ * To compile the test
+ *     $ g++ test_RevolvingDoorCombination.cpp -L/usr/lib/ -lgtest -lgtest_main -pthread -o test_all
+ *
+ * Then to run the test
+ *     $ ./test_all
+ */
+
+TEST( RevolvingDoorCombination, DefaultConstructor )
+{
+	RevolvingDoorCombination<> combination;
+
+	EXPECT_EQ( 0, combination.numberElements() );
+	EXPECT_EQ( 0, combination.subsetSize() );
+	EXPECT_EQ( combination.begin(), combination.end() );
+}
+
+TEST( RevolvingDoorCombination, MoveConstructor )
+{
+	RevolvingDoorCombination<> moveCombination( 7, 4 );
+	RevolvingDoorCombination<> defaultCombination( std::move( moveCombination ) );
+
+	EXPECT_EQ( 7, defaultCombination.numberElements() );
+	EXPECT_EQ( 4, defaultCombination.subsetSize() );
+	EXPECT_EQ( 0, moveCombination.numberElements() );
+	EXPECT_EQ( 0, moveCombination.subsetSize() );
+}
+
+TEST( RevolvingDoorCombination, constructorShouldThrowForNumberElementsBeyondRangeOfSizeType )
+{
+	EXPECT_THROW( RevolvingDoorCombination< uint8_t >( 257, 2 ), std::invalid_argument );
+}
+
+TEST( RevolvingDoorCombination, beginShouldReturnConstIteratorEqualToEndForNumberElementsLessThanSubsetSize )
+{
+	RevolvingDoorCombination<> combination( 3, 7 );
+
+	EXPECT_EQ( combination.begin(), combination.end() );
+}
+
+TEST( RevolvingDoorCombination, beginShouldReturnConstIteratorEqualToEndForSubsetSizeEqualsZero )
+{
+	RevolvingDoorCombination<> combination( 7, 0 );
+
+	EXPECT_EQ( combination.begin(), combination.end() );
+}
+
+TEST( RevolvingDoorCombination, shouldMatchKnuthsOrderForFiveChooseThree )
+{
+	RevolvingDoorCombination<> combination( 5, 3 );
+	std::vector< std::vector< size_t > > expected {
+		{ 0, 1, 2 }, { 0, 2, 3 }, { 1, 2, 3 }, { 0, 1, 3 }, { 0, 3, 4 },
+		{ 1, 3, 4 }, { 2, 3, 4 }, { 0, 2, 4 }, { 1, 2, 4 }, { 0, 1, 4 } };
+
+	EXPECT_EQ( expected, std::vector< std::vector< size_t > >( combination.begin(), combination.end() ) );
+}
+
+TEST( RevolvingDoorCombination, shouldEnumerateEachSubsetOnceWithOneSwapPerStep )
+{
+	for ( size_t numberElements = 1; numberElements <= 10; ++numberElements )
+	{
+		for ( size_t subsetSize = 1; subsetSize <= numberElements; ++subsetSize )
+		{
+			RevolvingDoorCombination<> combination( numberElements, subsetSize );
+			std::set< std::vector< size_t > > seen;
+			std::vector< size_t > previous;
+
+			for ( auto iterator = combination.begin(); iterator != combination.end(); ++iterator )
+			{
+				const auto& subset = *iterator;
+
+				ASSERT_TRUE( std::is_sorted( subset.begin(), subset.end() ) );
+				ASSERT_TRUE( seen.insert( subset ).second );
+
+				if ( not previous.empty() )
+				{
+					std::vector< size_t > removed;
+					std::vector< size_t > added;
+					std::set_difference( previous.begin(), previous.end(), subset.begin(), subset.end(), std::back_inserter( removed ) );
+					std::set_difference( subset.begin(), subset.end(), previous.begin(), previous.end(), std::back_inserter( added ) );
+
+					ASSERT_EQ( std::vector< size_t > { iterator.left() }, removed );
+					ASSERT_EQ( std::vector< size_t > { iterator.entered() }, added );
+				}
+
+				previous = subset;
+			}
+
+			EXPECT_EQ( Combination( numberElements, subsetSize ).size(), seen.size() )
+				<< numberElements << " choose " << subsetSize;
+		}
+	}
+}
+
+int main( int argc, char** argv )
+{
+	::testing::InitGoogleTest( &argc, argv );
+	return RUN_ALL_TESTS();
+}
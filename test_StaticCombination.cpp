@@ -0,0 +1,149 @@
+/**
+ * Copyright ©2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#include <array>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Combination.hpp"
+#include "StaticCombination.hpp"
+
+/**
+ * Notes:
+ *   - Requires that gtest is installed on the system.
+ *
+ * To compile the test
+ *     $ g++ test_StaticCombination.cpp -L/usr/lib/ -lgtest -lgtest_main -pthread -o test_all
+ *
+ * Then to run the test
+ *     $ ./test_all
+ */
+
+TEST( StaticCombination, DefaultConstructor )
+{
+	StaticCombination< 4 > combination;
+
+	EXPECT_EQ( 0, combination.numberElements() );
+	EXPECT_EQ( 4, combination.subsetSize() );
+}
+
+TEST( StaticCombination, MoveConstructor )
+{
+	StaticCombination< 4 > moveCombination( 7 );
+	StaticCombination< 4 > defaultCombination( std::move( moveCombination ) );
+
+	EXPECT_EQ( 7, defaultCombination.numberElements() );
+	EXPECT_EQ( 0, moveCombination.numberElements() );
+}
+
+TEST( StaticCombination, CopyConstructor )
+{
+	StaticCombination< 4 > copyCombination( 7 );
+	StaticCombination< 4 > defaultCombination( copyCombination );
+
+	EXPECT_EQ( 7, defaultCombination.numberElements() );
+	EXPECT_EQ( 7, copyCombination.numberElements() );
+}
+
+TEST( StaticCombination, constIteratorShouldBeTriviallyCopyable )
+{
+	EXPECT_TRUE( std::is_trivially_copyable< StaticCombination< 4 >::const_iterator >::value );
+}
+
+TEST( StaticCombination, beginShouldReturnConstIteratorEqualToEndForNumberElementsLessThanSubsetSize )
+{
+	StaticCombination< 7 > combination( 3 );
+
+	EXPECT_EQ( combination.begin(), combination.end() );
+}
+
+TEST( StaticCombination, beginShouldReturnConstIteratorEqualToEndForSubsetSizeEqualsZero )
+{
+	StaticCombination< 0 > combination( 7 );
+
+	EXPECT_EQ( combination.begin(), combination.end() );
+}
+
+TEST( StaticCombination, enumerationShouldMatchCombination )
+{
+	StaticCombination< 4 > staticCombination( 9 );
+	Combination combination( 9, 4 );
+	auto iterator = combination.begin();
+
+	for ( const auto& subset : staticCombination )
+	{
+		ASSERT_NE( iterator, combination.end() );
+		EXPECT_EQ( *iterator, std::vector< size_t >( subset.begin(), subset.end() ) );
+		++iterator;
+	}
+
+	EXPECT_EQ( iterator, combination.end() );
+}
+
+TEST( StaticCombination, postIncrementShouldReturnPriorEnumeration )
+{
+	StaticCombination< 2 > combination( 3 );
+	auto iterator = combination.begin();
+	auto previous = iterator++;
+
+	EXPECT_EQ( ( std::array< size_t, 2 > { 0, 1 } ), *previous );
+	EXPECT_EQ( ( std::array< size_t, 2 > { 0, 2 } ), *iterator );
+}
+
+TEST( StaticCombination, constructorShouldThrowForNumberElementsBeyondRangeOfSizeType )
+{
+	EXPECT_THROW( ( StaticCombination< 2, uint8_t >( 257 ) ), std::invalid_argument );
+}
+
+TEST( StaticCombination, combinationTableSizeShouldBeBinomialCoefficient )
+{
+	static_assert( 56 == combinationTableSize( 8, 3 ), "8 choose 3" );
+	static_assert( 1820 == combinationTableSize( 16, 4 ), "16 choose 4" );
+	static_assert( 0 == combinationTableSize( 3, 7 ), "no subsets for K > N" );
+	static_assert( 0 == combinationTableSize( 3, 0 ), "no subsets for K = 0" );
+
+	EXPECT_THROW( combinationTableSize( 200, 13 ), std::overflow_error );
+}
+
+TEST( StaticCombination, makeCombinationTableShouldMatchEnumeration )
+{
+	const auto table = makeCombinationTable< 16, 4, uint8_t >();
+	size_t index = 0;
+
+	ASSERT_EQ( 1820, table.size() );
+
+	for ( const auto& subset : StaticCombination< 4, uint8_t >( 16 ) )
+	{
+		ASSERT_EQ( subset, table[ index++ ] );
+	}
+}
+
+#if defined( __cpp_lib_array_constexpr ) && ( 201603L <= __cpp_lib_array_constexpr )
+TEST( StaticCombination, makeCombinationTableShouldBeBuiltAtCompileTime )
+{
+	static constexpr auto table = makeCombinationTable< 8, 3, uint8_t >();
+
+	static_assert( 56 == table.size(), "8 choose 3" );
+	static_assert( ( 0 == table[ 0 ][ 0 ] ) and ( 1 == table[ 0 ][ 1 ] ) and ( 2 == table[ 0 ][ 2 ] ), "first subset" );
+	static_assert( ( 5 == table[ 55 ][ 0 ] ) and ( 6 == table[ 55 ][ 1 ] ) and ( 7 == table[ 55 ][ 2 ] ), "last subset" );
+	static_assert( std::is_same< const std::array< std::array< uint8_t, 3 >, 56 >, decltype( table ) >::value, "packed subsets" );
+
+	constexpr StaticCombination< 3 > combination( 8 );
+	static_assert( combination.begin() != combination.end(), "constexpr iteration" );
+	static_assert( 8 == combination.numberElements(), "constexpr accessors" );
+
+	EXPECT_EQ( 7, table[ 55 ][ 2 ] );
+}
+#endif
+
+int main( int argc, char** argv )
+{
+	::testing::InitGoogleTest( &argc, argv );
+	return RUN_ALL_TESTS();
+}
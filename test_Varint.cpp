@@ -0,0 +1,82 @@
+/**
+ * Copyright ©2022. Brent Weichel. All Rights Reserved.
+ * Permission to use, copy, modify, and/or distribute this software, in whole
+ * or part by any means, without express prior written agreement is prohibited.
+ */
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "Varint.hpp"
+
+/**
+ * Notes:
+ *   - Requires that gtest is installed on the system.
+ *
+ * To compile the test
+ *     $ g++ test_Varint.cpp -L/usr/lib/ -lgtest -lgtest_main -pthread -o test_all
+ *
+ * Then to run the test
+ *     $ ./test_all
+ */
+
+TEST( Varint, writeShouldUseSevenBitsPerByte )
+{
+	std::vector< uint8_t > bytes;
+	writeVarint( bytes, 0 );
+	writeVarint( bytes, 127 );
+	writeVarint( bytes, 300 );
+
+	EXPECT_EQ( ( std::vector< uint8_t > { 0x00, 0x7F, 0xAC, 0x02 } ), bytes );
+
+	bytes.clear();
+	writeVarint( bytes, std::numeric_limits< uint64_t >::max() );
+	EXPECT_EQ( 10, bytes.size() );
+	EXPECT_EQ( 0x01, bytes.back() );
+}
+
+TEST( Varint, readShouldInvertWrite )
+{
+	std::vector< uint64_t > values { 0, 1, 127, 128, 300, uint64_t( 1 ) << 35, std::numeric_limits< uint64_t >::max() };
+	std::vector< uint8_t > bytes;
+
+	for ( uint64_t value : values )
+	{
+		writeVarint( bytes, value );
+	}
+
+	const uint8_t* data = bytes.data();
+	const uint8_t* last = data + bytes.size();
+
+	for ( uint64_t value : values )
+	{
+		EXPECT_EQ( value, readVarint( data, last ) );
+	}
+
+	EXPECT_EQ( last, data );
+}
+
+TEST( Varint, readShouldRejectTruncatedOrOversizedValues )
+{
+	std::vector< uint8_t > truncated { 0x80, 0x80 };
+	const uint8_t* data = truncated.data();
+	EXPECT_THROW( readVarint( data, data + truncated.size() ), std::invalid_argument );
+
+	std::vector< uint8_t > oversized( 9, 0xFF );
+	oversized.push_back( 0x02 );
+	data = oversized.data();
+	EXPECT_THROW( readVarint( data, data + oversized.size() ), std::invalid_argument );
+
+	std::vector< uint8_t > overlong( 10, 0x80 );
+	overlong.push_back( 0x00 );
+	data = overlong.data();
+	EXPECT_THROW( readVarint( data, data + overlong.size() ), std::invalid_argument );
+}
+
+int main( int argc, char** argv )
+{
+	::testing::InitGoogleTest( &argc, argv );
+	return RUN_ALL_TESTS();
+}